@@ -58,6 +58,7 @@
 #include <cstdlib>
 #include <limits>
 #include <list>
+#include <new>
 #include <sstream>
 #include <utility>
 
@@ -76,6 +77,10 @@
 # include <sys/resource.h>
 # define _VL_HAVE_GETRLIMIT
 #endif
+#if !defined(_WIN32) && !defined(__MINGW32__)
+# include <sys/mman.h>
+# define _VL_HAVE_MMAP
+#endif
 
 #include "verilated_threads.h"
 // clang-format on
@@ -455,119 +460,203 @@ void _vl_debug_print_w(int lbits, const WDataInP iwp) VL_MT_SAFE {
 //===========================================================================
 // Slow expressions
 
+// Wide multiply and divide work on limbs of two words when the compiler has a
+// 128-bit type for the double-limb products, else on single words.
+#ifdef __SIZEOF_INT128__
+using VlLimb = uint64_t;
+__extension__ typedef unsigned __int128 VlDLimb;
+#else
+using VlLimb = uint32_t;
+using VlDLimb = uint64_t;
+#endif
+constexpr int VL_LIMB_BITS = sizeof(VlLimb) * 8;
+constexpr int VL_LIMB_WORDS = sizeof(VlLimb) / sizeof(EData);
+// +1 for an extra limb during division normalization
+constexpr int VL_MULS_MAX_LIMBS = VL_MULS_MAX_WORDS / VL_LIMB_WORDS + 1;
+
+static int _vl_limbs_from_w(int words, const WDataInP iwp, VlLimb* lp) VL_MT_SAFE {
+    const int limbs = (words + VL_LIMB_WORDS - 1) / VL_LIMB_WORDS;
+    for (int i = 0; i < limbs; ++i) {
+        VlLimb limb = 0;
+        for (int k = 0; k < VL_LIMB_WORDS && i * VL_LIMB_WORDS + k < words; ++k) {
+            limb |= static_cast<VlLimb>(iwp[i * VL_LIMB_WORDS + k]) << (VL_EDATASIZE * k);
+        }
+        lp[i] = limb;
+    }
+    return limbs;
+}
+static void _vl_limbs_to_w(int words, WDataOutP owp, const VlLimb* lp) VL_MT_SAFE {
+    for (int w = 0; w < words; ++w) {
+        owp[w] = static_cast<EData>(lp[w / VL_LIMB_WORDS] >> (VL_EDATASIZE * (w % VL_LIMB_WORDS)));
+    }
+}
+// op[0, n) += ap[0, n), returns carry out
+static VlLimb _vl_limbs_add(int n, VlLimb* op, const VlLimb* ap) VL_MT_SAFE {
+    VlLimb carry = 0;
+    for (int i = 0; i < n; ++i) {
+        const VlDLimb t = static_cast<VlDLimb>(op[i]) + ap[i] + carry;
+        op[i] = static_cast<VlLimb>(t);
+        carry = static_cast<VlLimb>(t >> VL_LIMB_BITS);
+    }
+    return carry;
+}
+// Divide double limb hi:lo by d, requires hi < d so the quotient fits in a limb
+static inline VlLimb _vl_div_limb(VlLimb hi, VlLimb lo, VlLimb d, VlLimb& rem) VL_MT_SAFE {
+#if defined(__x86_64__) && defined(__GNUC__) && defined(__SIZEOF_INT128__)
+    // Compilers call a library routine for 128-bit division, as they cannot assume hi < d
+    VlLimb q;
+    __asm__("divq %4" : "=a"(q), "=d"(rem) : "a"(lo), "d"(hi), "rm"(d));
+    return q;
+#else
+    const VlDLimb n = (static_cast<VlDLimb>(hi) << VL_LIMB_BITS) | lo;
+    rem = static_cast<VlLimb>(n % d);
+    return static_cast<VlLimb>(n / d);
+#endif
+}
+
+// op[0, n) = low half of ap[0, n) * bp[0, n)
+// Karatsuba does not pay off for products truncated to VL_MULS_MAX_WORDS
+static void _vl_mul_limbs_lo(int n, VlLimb* op, const VlLimb* ap, const VlLimb* bp) VL_MT_SAFE {
+    for (int i = 0; i < n; ++i) op[i] = 0;
+    for (int i = 0; i < n; ++i) {
+        if (!ap[i]) continue;
+        VlLimb carry = 0;
+        for (int j = 0; i + j < n; ++j) {
+            const VlDLimb t = static_cast<VlDLimb>(ap[i]) * bp[j] + op[i + j] + carry;
+            op[i + j] = static_cast<VlLimb>(t);
+            carry = static_cast<VlLimb>(t >> VL_LIMB_BITS);
+        }
+    }
+}
+
+WDataOutP _vl_mul_w(int words, WDataOutP owp, const WDataInP lwp,
+                    const WDataInP rwp) VL_MT_SAFE {
+    VL_DEBUG_IFDEF(assert(words <= VL_MULS_MAX_WORDS););
+    VlLimb lp[VL_MULS_MAX_LIMBS];
+    VlLimb rp[VL_MULS_MAX_LIMBS];
+    VlLimb op[VL_MULS_MAX_LIMBS];
+    const int limbs = _vl_limbs_from_w(words, lwp, lp);
+    _vl_limbs_from_w(words, rwp, rp);
+    _vl_mul_limbs_lo(limbs, op, lp, rp);
+    _vl_limbs_to_w(words, owp, op);
+    // Last output word is dirty
+    return owp;
+}
+
 WDataOutP _vl_moddiv_w(int lbits, WDataOutP owp, const WDataInP lwp, const WDataInP rwp,
                        bool is_modulus) VL_MT_SAFE {
     // See Knuth Algorithm D.  Computes u/v = q.r
-    // This isn't massively tuned, as wide division is rare
     // for debug see V3Number version
     // Requires clean input
     const int words = VL_WORDS_I(lbits);
-    for (int i = 0; i < words; ++i) owp[i] = 0;
     // Find MSB and check for zero.
     const int umsbp1 = VL_MOSTSETBITP1_W(words, lwp);  // dividend
     const int vmsbp1 = VL_MOSTSETBITP1_W(words, rwp);  // divisor
     if (VL_UNLIKELY(vmsbp1 == 0)  // rwp==0 so division by zero.  Return 0.
         || VL_UNLIKELY(umsbp1 == 0)) {  // 0/x so short circuit and return 0
+        return VL_ZERO_W(lbits, owp);
+    }
+    if (umsbp1 < vmsbp1) {  // u < v so quotient is zero, remainder is u
+        return is_modulus ? VL_MEMCPY_W(owp, lwp, words) : VL_ZERO_W(lbits, owp);
+    }
+    if (umsbp1 <= VL_QUADSIZE) {  // Native 64-bit division
+        const QData u = VL_SET_QW(lwp);
+        const QData v = VL_SET_QW(rwp);
+        VL_ZERO_W(lbits, owp);
+        VL_SET_WQ(owp, is_modulus ? u % v : u / v);
         return owp;
     }
 
-    const int uw = VL_WORDS_I(umsbp1);  // aka "m" in the algorithm
-    const int vw = VL_WORDS_I(vmsbp1);  // aka "n" in the algorithm
-    VL_DEBUG_IFDEF(assert(uw <= VL_MULS_MAX_WORDS););
-    VL_DEBUG_IFDEF(assert(vw <= VL_MULS_MAX_WORDS););
-
-    if (vw == 1) {  // Single divisor word breaks rest of algorithm
-        uint64_t k = 0;
-        for (int j = uw - 1; j >= 0; --j) {
-            const uint64_t unw64 = ((k << 32ULL) + static_cast<uint64_t>(lwp[j]));
-            owp[j] = unw64 / static_cast<uint64_t>(rwp[0]);
-            k = unw64 - static_cast<uint64_t>(owp[j]) * static_cast<uint64_t>(rwp[0]);
+    if (vmsbp1 <= VL_EDATASIZE) {  // Single divisor word, native 64/32 division
+        const QData v = rwp[0];
+        QData k = 0;
+        for (int j = VL_WORDS_I(umsbp1) - 1; j >= 0; --j) {
+            const QData unw64 = (k << VL_EDATASIZE) | lwp[j];
+            owp[j] = static_cast<EData>(unw64 / v);
+            k = unw64 - static_cast<QData>(owp[j]) * v;
         }
+        for (int i = VL_WORDS_I(umsbp1); i < words; ++i) owp[i] = 0;
         if (is_modulus) {
-            owp[0] = k;
+            owp[0] = static_cast<EData>(k);
             for (int i = 1; i < words; ++i) owp[i] = 0;
         }
         return owp;
     }
 
-    // +1 word as we may shift during normalization
-    uint32_t un[VL_MULS_MAX_WORDS + 1];  // Fixed size, as MSVC++ doesn't allow [words] here
-    uint32_t vn[VL_MULS_MAX_WORDS + 1];  // v normalized
-
-    // Zero for ease of debugging and to save having to zero for shifts
-    // Note +1 as loop will use extra word
-    for (int i = 0; i < words + 1; ++i) un[i] = vn[i] = 0;
-
-    // Algorithm requires divisor MSB to be set
-    // Copy and shift to normalize divisor so MSB of vn[vw-1] is set
-    const int s = 31 - VL_BITBIT_I(vmsbp1 - 1);  // shift amount (0...31)
-    // Copy and shift dividend by same amount; may set new upper word
+    VlLimb un[VL_MULS_MAX_LIMBS + 1];  // Dividend, normalized, with extra limb
+    VlLimb vn[VL_MULS_MAX_LIMBS];  // Divisor, normalized
+    VlLimb qn[VL_MULS_MAX_LIMBS];  // Quotient
+    const int m = _vl_limbs_from_w(VL_WORDS_I(umsbp1), lwp, un);  // aka "m" in the algorithm
+    const int n = _vl_limbs_from_w(VL_WORDS_I(vmsbp1), rwp, vn);  // aka "n" in the algorithm
+    // Normalize so MSB of vn[n-1] is set; shift dividend by same amount into extra limb
+    const int s = n * VL_LIMB_BITS - vmsbp1;  // 0...VL_LIMB_BITS-1
+    un[m] = 0;
     if (s) {
-        for (int i = vw - 1; i > 0; --i) vn[i] = (rwp[i] << s) | (rwp[i - 1] >> (32 - s));
-        vn[0] = rwp[0] << s;
-        un[uw] = lwp[uw - 1] >> (32 - s);
-        for (int i = uw - 1; i > 0; --i) un[i] = (lwp[i] << s) | (lwp[i - 1] >> (32 - s));
-        un[0] = lwp[0] << s;
+        for (int i = n - 1; i > 0; --i) vn[i] = (vn[i] << s) | (vn[i - 1] >> (VL_LIMB_BITS - s));
+        vn[0] <<= s;
+        un[m] = un[m - 1] >> (VL_LIMB_BITS - s);
+        for (int i = m - 1; i > 0; --i) un[i] = (un[i] << s) | (un[i - 1] >> (VL_LIMB_BITS - s));
+        un[0] <<= s;
+    }
+    const VlDLimb base = static_cast<VlDLimb>(1) << VL_LIMB_BITS;
+
+    if (n == 1) {  // Single divisor limb breaks rest of algorithm
+        VlLimb k = un[m];  // < vn[0] as normalized
+        for (int j = m - 1; j >= 0; --j) qn[j] = _vl_div_limb(k, un[j], vn[0], k);
+        un[0] = k;
+        un[1] = 0;
     } else {
-        for (int i = vw - 1; i > 0; --i) vn[i] = rwp[i];
-        vn[0] = rwp[0];
-        un[uw] = 0;
-        for (int i = uw - 1; i > 0; --i) un[i] = lwp[i];
-        un[0] = lwp[0];
-    }
-
-    // Main loop
-    for (int j = uw - vw; j >= 0; --j) {
-        // Estimate
-        const uint64_t unw64
-            = (static_cast<uint64_t>(un[j + vw]) << 32ULL | static_cast<uint64_t>(un[j + vw - 1]));
-        uint64_t qhat = unw64 / static_cast<uint64_t>(vn[vw - 1]);
-        uint64_t rhat = unw64 - qhat * static_cast<uint64_t>(vn[vw - 1]);
-
-    again:
-        if (qhat >= 0x100000000ULL || ((qhat * vn[vw - 2]) > ((rhat << 32ULL) + un[j + vw - 2]))) {
-            qhat = qhat - 1;
-            rhat = rhat + vn[vw - 1];
-            if (rhat < 0x100000000ULL) goto again;
-        }
-
-        int64_t t = 0;  // Must be signed
-        uint64_t k = 0;
-        for (int i = 0; i < vw; ++i) {
-            const uint64_t p = qhat * vn[i];  // Multiply by estimate
-            t = un[i + j] - k - (p & 0xFFFFFFFFULL);  // Subtract
-            un[i + j] = t;
-            k = (p >> 32ULL) - (t >> 32ULL);
-        }
-        t = un[j + vw] - k;
-        un[j + vw] = t;
-        owp[j] = qhat;  // Save quotient digit
-
-        if (t < 0) {
-            // Over subtracted; correct by adding back
-            owp[j]--;
-            k = 0;
-            for (int i = 0; i < vw; ++i) {
-                t = static_cast<uint64_t>(un[i + j]) + static_cast<uint64_t>(vn[i]) + k;
-                un[i + j] = t;
-                k = t >> 32ULL;
+        for (int j = m - n; j >= 0; --j) {
+            // Estimate; un[j + n] <= vn[n - 1] so at most base - 1 when equal
+            VlDLimb qhat;
+            VlDLimb rhat;
+            if (un[j + n] >= vn[n - 1]) {
+                qhat = base - 1;
+                rhat = ((static_cast<VlDLimb>(un[j + n]) << VL_LIMB_BITS) | un[j + n - 1])
+                       - qhat * vn[n - 1];
+            } else {
+                VlLimb r;
+                qhat = _vl_div_limb(un[j + n], un[j + n - 1], vn[n - 1], r);
+                rhat = r;
+            }
+            while (rhat < base && qhat * vn[n - 2] > ((rhat << VL_LIMB_BITS) | un[j + n - 2])) {
+                --qhat;
+                rhat += vn[n - 1];
+            }
+            // Multiply and subtract
+            VlLimb carry = 0;
+            VlLimb borrow = 0;
+            for (int i = 0; i < n; ++i) {
+                const VlDLimb p = qhat * vn[i] + carry;
+                carry = static_cast<VlLimb>(p >> VL_LIMB_BITS);
+                const VlLimb plo = static_cast<VlLimb>(p) + borrow;
+                borrow = (plo < borrow) | (un[i + j] < plo);
+                un[i + j] -= plo;
+            }
+            const VlDLimb sub = static_cast<VlDLimb>(carry) + borrow;
+            const bool over = un[j + n] < sub;
+            un[j + n] -= static_cast<VlLimb>(sub);
+            qn[j] = static_cast<VlLimb>(qhat);  // Save quotient digit
+            if (over) {
+                // Over subtracted; correct by adding back
+                --qn[j];
+                un[j + n] += _vl_limbs_add(n, un + j, vn);
             }
-            un[j + vw] = un[j + vw] + k;
         }
     }
 
-    if (is_modulus) {  // modulus
+    if (is_modulus) {
         // Need to reverse normalization on copy to output
         if (s) {
-            for (int i = 0; i < vw; ++i) owp[i] = (un[i] >> s) | (un[i + 1] << (32 - s));
-        } else {
-            for (int i = 0; i < vw; ++i) owp[i] = un[i];
+            for (int i = 0; i < n; ++i) un[i] = (un[i] >> s) | (un[i + 1] << (VL_LIMB_BITS - s));
         }
-        for (int i = vw; i < words; ++i) owp[i] = 0;
-        return owp;
-    } else {  // division
-        return owp;
+        VL_ZERO_W(lbits, owp);
+        _vl_limbs_to_w(std::min(words, n * VL_LIMB_WORDS), owp, un);
+    } else {
+        VL_ZERO_W(lbits, owp);
+        _vl_limbs_to_w(std::min(words, (m - n + 1) * VL_LIMB_WORDS), owp, qn);
     }
+    return owp;
 }
 
 WDataOutP VL_POW_WWW(int obits, int, int rbits, WDataOutP owp, const WDataInP lwp,
@@ -818,6 +907,232 @@ std::string _vl_vsformat_time(char* tmp, T ld, int timeunit, bool left, size_t w
     return left ? (tmp + padding) : (padding + tmp);
 }
 
+static void _vl_vsformat_item(std::string& output, const VlFmtItem& item) VL_MT_SAFE {
+    // Format one conversion of a Verilog $write style format into the output list
+    // Shared by the runtime-parsed (_vl_vsformat) and pre-parsed (VL_*_L) formats
+    //
+    // Note uses a single buffer internally; presumes only one usage per printf
+    // Note also assumes variables < 64 are not wide, this assumption is
+    // sometimes not true in low-level routines written here in verilated.cpp
+    static thread_local char t_tmp[VL_VALUE_STRING_MAX_WIDTH];
+    const char fmt = item.m_fmt;
+    const bool widthSet = item.m_flags & VL_FMT_WIDTH;
+    const bool left = item.m_flags & VL_FMT_LEFT;
+    size_t width = item.m_width;
+    switch (fmt) {
+    case '\0':  // Literal text
+        output.append(static_cast<const char*>(item.m_ptr), item.m_len);
+        break;
+    case 'N': {  // "C" string with name of module, add . if needed
+        const char* const cstrp = static_cast<const char*>(item.m_ptr);
+        if (VL_LIKELY(*cstrp)) {
+            output += cstrp;
+            output += '.';
+        }
+        break;
+    }
+    case 'S': {  // "C" string
+        const char* const cstrp = static_cast<const char*>(item.m_ptr);
+        output += cstrp;
+        break;
+    }
+    case '@': {  // Verilog/C++ string
+        const std::string* const cstrp = static_cast<const std::string*>(item.m_ptr);
+        std::string padding;
+        if (width > cstrp->size()) padding.append(width - cstrp->size(), ' ');
+        output += left ? (*cstrp + padding) : (padding + *cstrp);
+        break;
+    }
+    case 'e':
+    case 'f':
+    case 'g':
+    case '^': {  // Realtime
+        const double d = item.m_d;
+        if (fmt == '^') {  // Realtime
+            if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
+            output += _vl_vsformat_time(t_tmp, d, item.m_timeunit, left, width);
+        } else {
+            VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, static_cast<const char*>(item.m_ptr),
+                        d);
+            output += t_tmp;
+        }
+        break;
+    }
+    default: {
+        // Deal with all read-and-print somethings
+        const int lbits = item.m_lbits;
+        const QData ld = item.m_ld;
+        VlWide<VL_WQ_WORDS_E> qlwp;
+        WDataInP lwp = nullptr;
+        if (lbits <= VL_QUADSIZE) {
+            VL_SET_WQ(qlwp, ld);
+            lwp = qlwp;
+        } else {
+            lwp = static_cast<WDataInP>(item.m_ptr);
+        }
+        int lsb = lbits - 1;
+        if (widthSet && width == 0) {
+            while (lsb && !VL_BITISSET_W(lwp, lsb)) --lsb;
+        }
+        switch (fmt) {
+        case 'c': {
+            const IData charval = ld & 0xff;
+            output += static_cast<char>(charval);
+            break;
+        }
+        case 's': {
+            std::string field;
+            for (; lsb >= 0; --lsb) {
+                lsb = (lsb / 8) * 8;  // Next digit
+                const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xff;
+                field += (charval == 0) ? ' ' : charval;
+            }
+            std::string padding;
+            if (width > field.size()) padding.append(width - field.size(), ' ');
+            output += left ? (field + padding) : (padding + field);
+            break;
+        }
+        case 'd':  // Signed decimal
+        case '#': {  // Unsigned decimal
+            const char* digitsp;
+            int digits;
+            std::string wideDec;
+            if (lbits <= VL_QUADSIZE) {
+                // Convert directly, snprintf is slow and this is the most common conversion
+                char* const endp = t_tmp + 24;
+                char* bufp = endp;
+                const bool neg
+                    = fmt == 'd' && static_cast<int64_t>(VL_EXTENDS_QQ(lbits, lbits, ld)) < 0;
+                uint64_t v = neg ? (0 - static_cast<uint64_t>(VL_EXTENDS_QQ(lbits, lbits, ld)))
+                                 : static_cast<uint64_t>(ld);
+                do {
+                    *--bufp = static_cast<char>('0' + v % 10);
+                    v /= 10;
+                } while (v);
+                if (neg) *--bufp = '-';
+                digitsp = bufp;
+                digits = static_cast<int>(endp - bufp);
+            } else {
+                if (fmt == 'd' && VL_SIGN_E(lbits, lwp[VL_WORDS_I(lbits) - 1])) {
+                    VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> neg;
+                    VL_NEGATE_W(VL_WORDS_I(lbits), neg, lwp);
+                    wideDec = "-"s + VL_DECIMAL_NW(lbits, neg);
+                } else {
+                    wideDec = VL_DECIMAL_NW(lbits, lwp);
+                }
+                digitsp = wideDec.data();
+                digits = static_cast<int>(wideDec.length());
+            }
+            const int needmore = static_cast<int>(width) - digits;
+            if (needmore > 0 && !left) {
+                // Pre-pad zero for %0, else spaces
+                output.append(needmore, (item.m_flags & VL_FMT_ZERO) ? '0' : ' ');
+            }
+            output.append(digitsp, digits);
+            if (needmore > 0 && left) output.append(needmore, ' ');  // Post-pad spaces
+            break;
+        }
+        case 't': {  // Time
+            if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
+            output += _vl_vsformat_time(t_tmp, ld, item.m_timeunit, left, width);
+            break;
+        }
+        case 'b':  // FALLTHRU
+        case 'o':  // FALLTHRU
+        case 'x': {
+            if (widthSet || left) {
+                lsb = VL_MOSTSETBITP1_W(VL_WORDS_I(lbits), lwp);
+                lsb = (lsb < 1) ? 0 : (lsb - 1);
+            }
+
+            std::string append;
+            int digits;
+            switch (fmt) {
+            case 'b': {
+                digits = lsb + 1;
+                for (; lsb >= 0; --lsb) append += (VL_BITRSHIFT_W(lwp, lsb) & 1) + '0';
+                break;
+            }
+            case 'o': {
+                digits = (lsb + 1 + 2) / 3;
+                for (; lsb >= 0; --lsb) {
+                    lsb = (lsb / 3) * 3;  // Next digit
+                    // Octal numbers may span more than one wide word,
+                    // so we need to grab each bit separately and check for overrun
+                    // Octal is rare, so we'll do it a slow simple way
+                    append += static_cast<char>(
+                        '0' + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 0)) ? 1 : 0)
+                        + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 1)) ? 2 : 0)
+                        + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 2)) ? 4 : 0));
+                }
+                break;
+            }
+            default: {  // 'x'
+                digits = (lsb + 1 + 3) / 4;
+                for (; lsb >= 0; --lsb) {
+                    lsb = (lsb / 4) * 4;  // Next digit
+                    const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xf;
+                    append += "0123456789abcdef"[charval];
+                }
+                break;
+            }
+            }  // switch
+
+            const int needmore = static_cast<int>(width) - digits;
+            if (needmore > 0) {
+                std::string padding;
+                if (left) {
+                    padding.append(needmore, ' ');  // Pre-pad spaces
+                    output += append + padding;
+                } else {
+                    padding.append(needmore, '0');  // Pre-pad zero
+                    output += padding + append;
+                }
+            } else {
+                output += append;
+            }
+            break;
+        }  // b / o / x
+        case 'u':
+        case 'z': {  // Packed 4-state
+            const bool is_4_state = (fmt == 'z');
+            output.reserve(output.size() + ((is_4_state ? 2 : 1) * VL_WORDS_I(lbits)));
+            int bytes_to_go = VL_BYTES_I(lbits);
+            int bit = 0;
+            while (bytes_to_go > 0) {
+                const int wr_bytes = std::min(4, bytes_to_go);
+                for (int byte = 0; byte < wr_bytes; byte++, bit += 8)
+                    output += static_cast<char>(VL_BITRSHIFT_W(lwp, bit) & 0xff);
+                output.append(4 - wr_bytes, static_cast<char>(0));
+                if (is_4_state) output.append(4, static_cast<char>(0));
+                bytes_to_go -= wr_bytes;
+            }
+            break;
+        }
+        case 'v':  // Strength; assume always strong
+            for (lsb = lbits - 1; lsb >= 0; --lsb) {
+                if (VL_BITRSHIFT_W(lwp, lsb) & 1) {
+                    output += "St1 ";
+                } else {
+                    output += "St0 ";
+                }
+            }
+            break;
+        default: {  // LCOV_EXCL_START
+            const std::string msg = "Unknown _vl_vsformat code: "s + fmt;
+            VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+            break;
+        }  // LCOV_EXCL_STOP
+        }  // switch
+    }
+    }  // switch
+}
+
+static void _vl_vsformat_items(std::string& output,
+                               std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    for (const VlFmtItem& item : items) _vl_vsformat_item(output, item);
+}
+
 // Do a va_arg returning a quad, assuming input argument is anything less than wide
 #define VL_VA_ARG_Q_(ap, bits) (((bits) <= VL_IDATASIZE) ? va_arg(ap, IData) : va_arg(ap, QData))
 
@@ -825,22 +1140,15 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
     // Format a Verilog $write style format into the output list
     // The format must be pre-processed (and lower cased) by Verilator
     // Arguments are in "width, arg-value (or WDataIn* if wide)" form
-    //
-    // Note uses a single buffer internally; presumes only one usage per printf
-    // Note also assumes variables < 64 are not wide, this assumption is
-    // sometimes not true in low-level routines written here in verilated.cpp
-    static thread_local char t_tmp[VL_VALUE_STRING_MAX_WIDTH];
+    // Verilator normally pre-parses formats into VlFmtItems instead, see VL_WRITEF_L
     std::string::const_iterator pctit = format.end();  // Most recent %##.##g format
     bool inPct = false;
-    bool widthSet = false;
-    bool left = false;
-    size_t width = 0;
+    VlFmtItem item{};
     for (std::string::const_iterator pos = format.cbegin(); pos != format.cend(); ++pos) {
         if (!inPct && pos[0] == '%') {
             pctit = pos;
             inPct = true;
-            widthSet = false;
-            width = 0;
+            item = VlFmtItem{};
         } else if (!inPct) {  // Normal text
             // Fast-forward to next escape and add to output
             std::string::const_iterator ep = pos;
@@ -852,6 +1160,7 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
         } else {  // Format character
             inPct = false;
             const char fmt = pos[0];
+            item.m_fmt = fmt;
             switch (fmt) {
             case '0':  // FALLTHRU
             case '1':  // FALLTHRU
@@ -864,11 +1173,12 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
             case '8':  // FALLTHRU
             case '9':
                 inPct = true;  // Get more digits
-                widthSet = true;
-                width = width * 10 + (fmt - '0');
+                if (fmt == '0' && pos == pctit + 1) item.m_flags |= VL_FMT_ZERO;
+                item.m_flags |= VL_FMT_WIDTH;
+                item.m_width = item.m_width * 10 + (fmt - '0');
                 break;
             case '-':
-                left = true;
+                item.m_flags |= VL_FMT_LEFT;
                 inPct = true;  // Get more digits
                 break;
             case '.':
@@ -877,240 +1187,42 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
             case '%':  //
                 output += '%';
                 break;
-            case 'N': {  // "C" string with name of module, add . if needed
-                const char* const cstrp = va_arg(ap, const char*);
-                if (VL_LIKELY(*cstrp)) {
-                    output += cstrp;
-                    output += '.';
-                }
+            case 'N':  // "C" string with name of module, add . if needed
+            case 'S':  // "C" string
+                item.m_ptr = va_arg(ap, const char*);
+                _vl_vsformat_item(output, item);
                 break;
-            }
-            case 'S': {  // "C" string
-                const char* const cstrp = va_arg(ap, const char*);
-                output += cstrp;
+            case '@':  // Verilog/C++ string
+                item.m_lbits = va_arg(ap, int);  // # bits is ignored
+                item.m_ptr = va_arg(ap, const std::string*);
+                _vl_vsformat_item(output, item);
                 break;
-            }
-            case '@': {  // Verilog/C++ string
-                va_arg(ap, int);  // # bits is ignored
-                const std::string* const cstrp = va_arg(ap, const std::string*);
-                std::string padding;
-                if (width > cstrp->size()) padding.append(width - cstrp->size(), ' ');
-                output += left ? (*cstrp + padding) : (padding + *cstrp);
-                break;
-            }
             case 'e':
             case 'f':
             case 'g':
             case '^': {  // Realtime
-                const int lbits = va_arg(ap, int);
-                const double d = va_arg(ap, double);
-                (void)lbits;  // UNUSED - always 64
-                if (fmt == '^') {  // Realtime
-                    if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
-                    const int timeunit = va_arg(ap, int);
-                    output += _vl_vsformat_time(t_tmp, d, timeunit, left, width);
-                } else {
-                    const std::string fmts{pctit, pos + 1};
-                    VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, fmts.c_str(), d);
-                    output += t_tmp;
-                }
+                item.m_lbits = va_arg(ap, int);  // UNUSED - always 64
+                item.m_d = va_arg(ap, double);
+                if (fmt == '^') item.m_timeunit = va_arg(ap, int);
+                const std::string fmts{pctit, pos + 1};
+                item.m_ptr = fmts.c_str();
+                _vl_vsformat_item(output, item);
                 break;
             }
             default: {
                 // Deal with all read-and-print somethings
                 const int lbits = va_arg(ap, int);
-                QData ld = 0;
-                VlWide<VL_WQ_WORDS_E> qlwp;
-                WDataInP lwp = nullptr;
+                item.m_lbits = lbits;
                 if (lbits <= VL_QUADSIZE) {
-                    ld = VL_VA_ARG_Q_(ap, lbits);
-                    VL_SET_WQ(qlwp, ld);
-                    lwp = qlwp;
+                    item.m_ld = VL_VA_ARG_Q_(ap, lbits);
                 } else {
-                    lwp = va_arg(ap, WDataInP);
-                    ld = lwp[0];
-                }
-                int lsb = lbits - 1;
-                if (widthSet && width == 0) {
-                    while (lsb && !VL_BITISSET_W(lwp, lsb)) --lsb;
-                }
-                switch (fmt) {
-                case 'c': {
-                    const IData charval = ld & 0xff;
-                    output += static_cast<char>(charval);
-                    break;
-                }
-                case 's': {
-                    std::string field;
-                    for (; lsb >= 0; --lsb) {
-                        lsb = (lsb / 8) * 8;  // Next digit
-                        const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xff;
-                        field += (charval == 0) ? ' ' : charval;
-                    }
-                    std::string padding;
-                    if (width > field.size()) padding.append(width - field.size(), ' ');
-                    output += left ? (field + padding) : (padding + field);
-                    break;
-                }
-                case 'd': {  // Signed decimal
-                    int digits = 0;
-                    std::string append;
-                    if (lbits <= VL_QUADSIZE) {
-                        digits
-                            = VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRId64,
-                                          static_cast<int64_t>(VL_EXTENDS_QQ(lbits, lbits, ld)));
-                        append = t_tmp;
-                    } else {
-                        if (VL_SIGN_E(lbits, lwp[VL_WORDS_I(lbits) - 1])) {
-                            VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> neg;
-                            VL_NEGATE_W(VL_WORDS_I(lbits), neg, lwp);
-                            append = "-"s + VL_DECIMAL_NW(lbits, neg);
-                        } else {
-                            append = VL_DECIMAL_NW(lbits, lwp);
-                        }
-                        digits = static_cast<int>(append.length());
-                    }
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
-                        } else {
-                            if (pctit != format.end() && pctit[0] && pctit[1] == '0') {  // %0
-                                padding.append(needmore, '0');  // Pre-pad zero
-                            } else {
-                                padding.append(needmore, ' ');  // Pre-pad spaces
-                            }
-                            output += padding + append;
-                        }
-                    } else {
-                        output += append;
-                    }
-                    break;
+                    const WDataInP lwp = va_arg(ap, WDataInP);
+                    item.m_ptr = lwp;
+                    item.m_ld = lwp[0];
                 }
-                case '#': {  // Unsigned decimal
-                    int digits = 0;
-                    std::string append;
-                    if (lbits <= VL_QUADSIZE) {
-                        digits = VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64, ld);
-                        append = t_tmp;
-                    } else {
-                        append = VL_DECIMAL_NW(lbits, lwp);
-                        digits = static_cast<int>(append.length());
-                    }
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
-                        } else {
-                            if (pctit != format.end() && pctit[0] && pctit[1] == '0') {  // %0
-                                padding.append(needmore, '0');  // Pre-pad zero
-                            } else {
-                                padding.append(needmore, ' ');  // Pre-pad spaces
-                            }
-                            output += padding + append;
-                        }
-                    } else {
-                        output += append;
-                    }
-                    break;
-                }
-                case 't': {  // Time
-                    if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
-                    const int timeunit = va_arg(ap, int);
-                    output += _vl_vsformat_time(t_tmp, ld, timeunit, left, width);
-                    break;
-                }
-                case 'b':  // FALLTHRU
-                case 'o':  // FALLTHRU
-                case 'x': {
-                    if (widthSet || left) {
-                        lsb = VL_MOSTSETBITP1_W(VL_WORDS_I(lbits), lwp);
-                        lsb = (lsb < 1) ? 0 : (lsb - 1);
-                    }
-
-                    std::string append;
-                    int digits;
-                    switch (fmt) {
-                    case 'b': {
-                        digits = lsb + 1;
-                        for (; lsb >= 0; --lsb) append += (VL_BITRSHIFT_W(lwp, lsb) & 1) + '0';
-                        break;
-                    }
-                    case 'o': {
-                        digits = (lsb + 1 + 2) / 3;
-                        for (; lsb >= 0; --lsb) {
-                            lsb = (lsb / 3) * 3;  // Next digit
-                            // Octal numbers may span more than one wide word,
-                            // so we need to grab each bit separately and check for overrun
-                            // Octal is rare, so we'll do it a slow simple way
-                            append += static_cast<char>(
-                                '0' + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 0)) ? 1 : 0)
-                                + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 1)) ? 2 : 0)
-                                + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 2)) ? 4 : 0));
-                        }
-                        break;
-                    }
-                    default: {  // 'x'
-                        digits = (lsb + 1 + 3) / 4;
-                        for (; lsb >= 0; --lsb) {
-                            lsb = (lsb / 4) * 4;  // Next digit
-                            const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xf;
-                            append += "0123456789abcdef"[charval];
-                        }
-                        break;
-                    }
-                    }  // switch
-
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
-                        } else {
-                            padding.append(needmore, '0');  // Pre-pad zero
-                            output += padding + append;
-                        }
-                    } else {
-                        output += append;
-                    }
-                    break;
-                }  // b / o / x
-                case 'u':
-                case 'z': {  // Packed 4-state
-                    const bool is_4_state = (fmt == 'z');
-                    output.reserve(output.size() + ((is_4_state ? 2 : 1) * VL_WORDS_I(lbits)));
-                    int bytes_to_go = VL_BYTES_I(lbits);
-                    int bit = 0;
-                    while (bytes_to_go > 0) {
-                        const int wr_bytes = std::min(4, bytes_to_go);
-                        for (int byte = 0; byte < wr_bytes; byte++, bit += 8)
-                            output += static_cast<char>(VL_BITRSHIFT_W(lwp, bit) & 0xff);
-                        output.append(4 - wr_bytes, static_cast<char>(0));
-                        if (is_4_state) output.append(4, static_cast<char>(0));
-                        bytes_to_go -= wr_bytes;
-                    }
-                    break;
-                }
-                case 'v':  // Strength; assume always strong
-                    for (lsb = lbits - 1; lsb >= 0; --lsb) {
-                        if (VL_BITRSHIFT_W(lwp, lsb) & 1) {
-                            output += "St1 ";
-                        } else {
-                            output += "St0 ";
-                        }
-                    }
-                    break;
-                default: {  // LCOV_EXCL_START
-                    const std::string msg = "Unknown _vl_vsformat code: "s + pos[0];
-                    VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
-                    break;
-                }  // LCOV_EXCL_STOP
-                }  // switch
+                if (fmt == 't') item.m_timeunit = va_arg(ap, int);
+                _vl_vsformat_item(output, item);
+                break;
             }
             }  // switch
         }
@@ -1629,6 +1741,71 @@ void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SA
     Verilated::threadContextp()->impp()->fdWrite(fpi, t_output);
 }
 
+void VL_SFORMAT_L(int obits, CData& destr, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
+}
+
+void VL_SFORMAT_L(int obits, SData& destr, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
+}
+
+void VL_SFORMAT_L(int obits, IData& destr, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
+}
+
+void VL_SFORMAT_L(int obits, QData& destr, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
+}
+
+void VL_SFORMAT_L(int obits, void* destp, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    _vl_string_to_vint(obits, destp, t_output.length(), t_output.c_str());
+}
+
+void VL_SFORMAT_L(int obits_ignored, std::string& output,
+                  std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    (void)obits_ignored;  // So VL_SFORMAT_L function signatures all match
+    std::string temp_output;  // Items may reference output
+    _vl_vsformat_items(temp_output, items);
+    output = temp_output;
+}
+
+std::string VL_SFORMATF_N_L(std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    return t_output;
+}
+
+void VL_WRITEF_L(std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    VL_PRINTF_MT("%s", t_output.c_str());
+}
+
+void VL_FWRITEF_L(IData fpi, std::initializer_list<VlFmtItem> items) VL_MT_SAFE {
+    // While threadsafe, each thread can only access different file handles
+    static thread_local std::string t_output;  // static only for speed
+    t_output = "";
+    _vl_vsformat_items(t_output, items);
+    Verilated::threadContextp()->impp()->fdWrite(fpi, t_output);
+}
+
 IData VL_FSCANF_INX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE {
     // While threadsafe, each thread can only access different file handles
     FILE* const fp = VL_CVT_I_FP(fpi);
@@ -3042,6 +3219,31 @@ VerilatedSyms::~VerilatedSyms() {
     delete __Vm_evalMsgQp;
 }
 
+void* VerilatedSyms::lazyAlloc(size_t size) {
+#ifdef _VL_HAVE_MMAP
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;  // Do not require swap for pages that are never touched
+#endif
+    void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (VL_UNLIKELY(ptr == MAP_FAILED)) throw std::bad_alloc{};
+    return ptr;
+#else
+    // calloc of large blocks maps fresh zero pages on most platforms
+    void* const ptr = std::calloc(1, size);
+    if (VL_UNLIKELY(!ptr)) throw std::bad_alloc{};
+    return ptr;
+#endif
+}
+
+void VerilatedSyms::lazyFree(void* ptr, size_t size) VL_MT_SAFE {
+#ifdef _VL_HAVE_MMAP
+    munmap(ptr, size);
+#else
+    std::free(ptr);
+#endif
+}
+
 //===========================================================================
 // Verilated:: Methods
 
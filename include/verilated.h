@@ -692,6 +692,10 @@ public:  // But for internal use only
     explicit VerilatedSyms(VerilatedContext* contextp);  // Pass null for default context
     ~VerilatedSyms();
     VL_UNCOPYABLE(VerilatedSyms);
+    // Allocate zero-filled memory whose pages are only committed when first touched,
+    // used for model state under --lazy-array-size
+    static void* lazyAlloc(size_t size);
+    static void lazyFree(void* ptr, size_t size) VL_MT_SAFE;
 };
 
 //===========================================================================
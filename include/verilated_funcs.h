@@ -28,6 +28,9 @@
 #error "verilated_funcs.h should only be included by verilated.h"
 #endif
 
+#include "verilated_intrinsics.h"
+
+#include <initializer_list>
 #include <string>
 
 //=========================================================================
@@ -121,6 +124,8 @@ extern WDataOutP VL_ZERO_RESET_W(int obits, WDataOutP outwp) VL_MT_SAFE;
 extern void VL_PRINTTIMESCALE(const char* namep, const char* timeunitp,
                               const VerilatedContext* contextp) VL_MT_SAFE;
 
+extern WDataOutP _vl_mul_w(int words, WDataOutP owp, WDataInP const lwp,
+                           WDataInP const rwp) VL_MT_SAFE;
 extern WDataOutP _vl_moddiv_w(int lbits, WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
                               bool is_modulus) VL_MT_SAFE;
 
@@ -140,6 +145,77 @@ extern IData VL_FREAD_I(int width, int array_lsb, int array_size, void* memp, ID
 extern void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE;
 extern void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
 
+//=========================================================================
+// Pre-parsed $display formats
+//
+// Verilator splits each $display-like format into literal text and one
+// item per conversion when it creates the C++, so at runtime the output is
+// just a sequence of appends, with no format parsing or va_list walking.
+
+// Flags for the conversion items
+#define VL_FMT_LEFT 1  // '-' seen, left justify
+#define VL_FMT_WIDTH 2  // Width digits seen, even if zero
+#define VL_FMT_ZERO 4  // Leading '0' seen, pad decimal with zeros
+
+// One pre-parsed piece of a $display-like format
+struct VlFmtItem final {
+    const void* m_ptr;  // Literal text, %m name, %e/f/g C format, std::string*, or WDataInP
+    QData m_ld;  // Value if not wide
+    double m_d;  // Value if real
+    size_t m_len;  // Length of literal text
+    int m_lbits;  // Width of value in bits, or -1 if std::string
+    int m_width;  // Field width from format
+    int m_timeunit;  // Timeunit for %t and %^
+    char m_fmt;  // Conversion code as in _vl_vsformat, or '\0' for literal text
+    uint8_t m_flags;  // VL_FMT_* flags
+};
+
+// Item for literal text, len may include embedded NULs
+inline VlFmtItem VL_FMT_LIT(const char* strp, size_t len) VL_PURE {
+    return VlFmtItem{strp, 0, 0.0, len, 0, 0, 0, '\0', 0};
+}
+// Item for %m, 'N' appends "." after the name when non-empty, 'S' does not
+inline VlFmtItem VL_FMT_S(char fmt, const char* cstrp) VL_PURE {
+    return VlFmtItem{cstrp, 0, 0.0, 0, 0, 0, 0, fmt, 0};
+}
+// Item for a narrow or quad value
+inline VlFmtItem VL_FMT_Q(char fmt, int flags, int width, int lbits, QData ld,
+                          int timeunit = 0) VL_PURE {
+    return VlFmtItem{nullptr, ld, 0.0, 0, lbits, width, timeunit, fmt,
+                     static_cast<uint8_t>(flags)};
+}
+// Item for a wide value
+inline VlFmtItem VL_FMT_W(char fmt, int flags, int width, int lbits, WDataInP lwp,
+                          int timeunit = 0) VL_PURE {
+    return VlFmtItem{lwp, lwp[0], 0.0, 0, lbits, width, timeunit, fmt,
+                     static_cast<uint8_t>(flags)};
+}
+// Item for a real value; %e/%f/%g pass their C format, %^ its timeunit
+inline VlFmtItem VL_FMT_R(char fmt, int flags, int width, const char* cfmtp, double d,
+                          int timeunit = 0) VL_PURE {
+    return VlFmtItem{cfmtp, 0, d, 0, 64, width, timeunit, fmt, static_cast<uint8_t>(flags)};
+}
+// Item for a std::string value (%s of a string)
+inline VlFmtItem VL_FMT_N(int flags, int width, const std::string& str) VL_PURE {
+    return VlFmtItem{&str, 0, 0.0, 0, -1, width, 0, '@', static_cast<uint8_t>(flags)};
+}
+
+extern void VL_WRITEF_L(std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_FWRITEF_L(IData fpi, std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits, CData& destr,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits, SData& destr,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits, IData& destr,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits, QData& destr,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits, void* destp,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern void VL_SFORMAT_L(int obits_ignored, std::string& output,
+                         std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+extern std::string VL_SFORMATF_N_L(std::initializer_list<VlFmtItem> items) VL_MT_SAFE;
+
 extern IData VL_FSCANF_INX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
 extern IData VL_SSCANF_IINX(int lbits, IData ld, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
@@ -197,6 +273,66 @@ extern const char* vl_mc_scan_plusargs(const char* prefixp) VL_MT_SAFE;  // PLIi
      | (static_cast<QData>((lwp)[1]) << (static_cast<QData>(VL_EDATASIZE))))
 #define VL_SET_QII(ld, rd) ((static_cast<QData>(ld) << 32ULL) | static_cast<QData>(rd))
 
+// Unaligned vector loads/stores of WData words, used by the SIMD paths of the
+// wide operators. WData has no alignment beyond EData.
+#ifdef VL_HAVE_SSE2
+static inline __m128i _vl_simd_load128(const EData* p) VL_PURE {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+static inline void _vl_simd_store128(EData* p, __m128i v) VL_MT_SAFE {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+#endif
+#ifdef VL_HAVE_AVX2
+static inline __m256i _vl_simd_load256(const EData* p) VL_PURE {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+static inline void _vl_simd_store256(EData* p, __m256i v) VL_MT_SAFE {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+#endif
+#ifdef VL_HAVE_AVX512
+static inline __m512i _vl_simd_load512(const EData* p) VL_PURE { return _mm512_loadu_si512(p); }
+static inline void _vl_simd_store512(EData* p, __m512i v) VL_MT_SAFE { _mm512_storeu_si512(p, v); }
+#endif
+
+// Vectorized part of a word-wise bitwise operator 'op' (and/or/xor), using the
+// widest available vectors; advances 'i' to the first word left for the scalar loop.
+// Arguments must not have side effects
+// clang-format off
+#if defined(VL_HAVE_AVX512)
+# define VL_SIMD_BITOP_W_(op, words, i, owp, lwp, rwp) \
+    do { \
+        for (; (i) + 16 <= (words); (i) += 16) \
+            _vl_simd_store512((owp) + (i), _mm512_##op##_si512(_vl_simd_load512((lwp) + (i)), \
+                                                               _vl_simd_load512((rwp) + (i)))); \
+        for (; (i) + 8 <= (words); (i) += 8) \
+            _vl_simd_store256((owp) + (i), _mm256_##op##_si256(_vl_simd_load256((lwp) + (i)), \
+                                                               _vl_simd_load256((rwp) + (i)))); \
+    } while (false)
+#elif defined(VL_HAVE_AVX2)
+# define VL_SIMD_BITOP_W_(op, words, i, owp, lwp, rwp) \
+    do { \
+        for (; (i) + 8 <= (words); (i) += 8) \
+            _vl_simd_store256((owp) + (i), _mm256_##op##_si256(_vl_simd_load256((lwp) + (i)), \
+                                                               _vl_simd_load256((rwp) + (i)))); \
+        for (; (i) + 4 <= (words); (i) += 4) \
+            _vl_simd_store128((owp) + (i), _mm_##op##_si128(_vl_simd_load128((lwp) + (i)), \
+                                                            _vl_simd_load128((rwp) + (i)))); \
+    } while (false)
+#elif defined(VL_HAVE_SSE2)
+# define VL_SIMD_BITOP_W_(op, words, i, owp, lwp, rwp) \
+    do { \
+        for (; (i) + 4 <= (words); (i) += 4) \
+            _vl_simd_store128((owp) + (i), _mm_##op##_si128(_vl_simd_load128((lwp) + (i)), \
+                                                            _vl_simd_load128((rwp) + (i)))); \
+    } while (false)
+#else
+# define VL_SIMD_BITOP_W_(op, words, i, owp, lwp, rwp) \
+    do { } while (false)
+#endif
+// clang-format on
+
 // Return FILE* from IData
 extern FILE* VL_CVT_I_FP(IData lhs) VL_MT_SAFE;
 
@@ -704,8 +840,19 @@ static inline IData VL_REDXOR_64(QData r) VL_PURE {
 #endif
 }
 static inline IData VL_REDXOR_W(int words, WDataInP const lwp) VL_PURE {
-    EData r = lwp[0];
-    for (int i = 1; i < words; ++i) r ^= lwp[i];
+    EData r = 0;
+    int i = 0;
+#ifdef VL_HAVE_SSE2
+    if (words >= 8) {
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= words; i += 4) acc = _mm_xor_si128(acc, _vl_simd_load128(lwp + i));
+        // Fold the four lanes together
+        acc = _mm_xor_si128(acc, _mm_shuffle_epi32(acc, 0x4e));
+        acc = _mm_xor_si128(acc, _mm_shuffle_epi32(acc, 0xb1));
+        r = static_cast<EData>(_mm_cvtsi128_si32(acc));
+    }
+#endif
+    for (; i < words; ++i) r ^= lwp[i];
     return VL_REDXOR_32(r);
 }
 
@@ -724,7 +871,16 @@ static inline IData VL_COUNTONES_Q(QData lhs) VL_PURE {
 #define VL_COUNTONES_E VL_COUNTONES_I
 static inline IData VL_COUNTONES_W(int words, WDataInP const lwp) VL_PURE {
     EData r = 0;
-    for (int i = 0; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
+    int i = 0;
+#ifdef VL_HAVE_POPCNT
+    // Hardware popcount is faster than VL_COUNTONES_E, so use it two words at a time
+    for (; i + 2 <= words; i += 2) {
+        QData q;
+        std::memcpy(&q, lwp + i, sizeof(q));
+        r += static_cast<EData>(__builtin_popcountll(q));
+    }
+#endif
+    for (; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
     return r;
 }
 
@@ -840,30 +996,61 @@ static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    int i = 0;
+    VL_SIMD_BITOP_W_(and, words, i, owp, lwp, rwp);
+    for (; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                                 WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    int i = 0;
+    VL_SIMD_BITOP_W_(or, words, i, owp, lwp, rwp);
+    for (; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 static inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     IData od = 0;
-    for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_HAVE_SSE2
+    if (words >= 8) {
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= words; i += 4) {
+            acc = _mm_or_si128(
+                acc, _mm_xor_si128(_vl_simd_load128(lwp + i), _vl_simd_load128(rwp + i)));
+        }
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0x4e));
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0xb1));
+        od = static_cast<IData>(_mm_cvtsi128_si32(acc));
+    }
+#endif
+    for (; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
     return od;
 }
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    int i = 0;
+    VL_SIMD_BITOP_W_(xor, words, i, owp, lwp, rwp);
+    for (; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
+    int i = 0;
+#if defined(VL_HAVE_AVX2)
+    const __m256i ones = _mm256_set1_epi32(-1);
+    for (; i + 8 <= words; i += 8) {
+        _vl_simd_store256(owp + i, _mm256_xor_si256(_vl_simd_load256(lwp + i), ones));
+    }
+#elif defined(VL_HAVE_SSE2)
+    const __m128i ones = _mm_set1_epi32(-1);
+    for (; i + 4 <= words; i += 4) {
+        _vl_simd_store128(owp + i, _mm_xor_si128(_vl_simd_load128(lwp + i), ones));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = ~(lwp[i]);
     return owp;
 }
 
@@ -885,7 +1072,27 @@ static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) V
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 static inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     EData nequal = 0;
-    for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#if defined(VL_HAVE_AVX2)
+    if (words >= 8) {
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= words; i += 8) {
+            acc = _mm256_or_si256(
+                acc, _mm256_xor_si256(_vl_simd_load256(lwp + i), _vl_simd_load256(rwp + i)));
+        }
+        nequal = !_mm256_testz_si256(acc, acc);
+    }
+#elif defined(VL_HAVE_SSE2)
+    if (words >= 4) {
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= words; i += 4) {
+            acc = _mm_or_si128(
+                acc, _mm_xor_si128(_vl_simd_load128(lwp + i), _vl_simd_load128(rwp + i)));
+        }
+        nequal = _mm_movemask_epi8(_mm_cmpeq_epi32(acc, _mm_setzero_si128())) != 0xffff;
+    }
+#endif
+    for (; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
     return (nequal == 0);
 }
 
@@ -1005,8 +1212,21 @@ static inline QData VL_MODDIV_QQQ(int lbits, QData lhs, QData rhs) {
 
 static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
+    int i = 0;
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+#ifdef VL_HAVE_ADDCARRY
+    // Add two words at a time, chaining through the carry flag
+    unsigned char cf = 0;
+    for (; i + 2 <= words; i += 2) {
+        unsigned long long l, r, o;
+        std::memcpy(&l, lwp + i, sizeof(l));
+        std::memcpy(&r, rwp + i, sizeof(r));
+        cf = _addcarry_u64(cf, l, r, &o);
+        std::memcpy(owp + i, &o, sizeof(o));
+    }
+    carry = cf;
+#endif
+    for (; i < words; ++i) {
         carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
@@ -1017,8 +1237,22 @@ static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
 
 static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
+    int i = 0;
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+#ifdef VL_HAVE_ADDCARRY
+    // Subtract two words at a time, chaining through the borrow flag
+    unsigned char bf = 0;
+    for (; i + 2 <= words; i += 2) {
+        unsigned long long l, r, o;
+        std::memcpy(&l, lwp + i, sizeof(l));
+        std::memcpy(&r, rwp + i, sizeof(r));
+        bf = _subborrow_u64(bf, l, r, &o);
+        std::memcpy(owp + i, &o, sizeof(o));
+    }
+    // Carry out of lwp + ~rwp + 1; if no pairs were done the scalar loop adds the 1
+    if (i) carry = !bf;
+#endif
+    for (; i < words; ++i) {
         carry = (carry + static_cast<QData>(lwp[i])
                  + static_cast<QData>(static_cast<IData>(~rwp[i])));
         if (i == 0) ++carry;  // Negation of rwp
@@ -1029,17 +1263,132 @@ static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
     return owp;
 }
 
+//===================================================================
+// WIDTH-SPECIALIZED WIDE OPERATORS
+//
+// Versions of the above for a compile-time number of words, as in VlWide<N_Words>.
+// Verilator emits these for widths up to VL_WIDE_TEMPLATE_WORDS, e.g.
+// VL_AND_W<4>(owp, lwp, rwp); each word is a separate statement so the
+// compiler produces straight-line code without relying on loop unrolling.
+
+// Expand 'expr' once per word index in the parameter pack 'I', in order
+#define VL_WIDE_UNROLL_(expr) (void)std::initializer_list<int> { ((expr), 0)... }
+
+template <std::size_t... I>
+static inline void _vl_and_w(WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                             std::index_sequence<I...>) VL_MT_SAFE {
+    VL_WIDE_UNROLL_(owp[I] = lwp[I] & rwp[I]);
+}
+template <std::size_t... I>
+static inline void _vl_or_w(WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                            std::index_sequence<I...>) VL_MT_SAFE {
+    VL_WIDE_UNROLL_(owp[I] = lwp[I] | rwp[I]);
+}
+template <std::size_t... I>
+static inline void _vl_xor_w(WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                             std::index_sequence<I...>) VL_MT_SAFE {
+    VL_WIDE_UNROLL_(owp[I] = lwp[I] ^ rwp[I]);
+}
+template <std::size_t... I>
+static inline void _vl_not_w(WDataOutP owp, WDataInP const lwp,
+                             std::index_sequence<I...>) VL_MT_SAFE {
+    VL_WIDE_UNROLL_(owp[I] = ~lwp[I]);
+}
+template <std::size_t... I>
+static inline EData _vl_nequal_w(WDataInP const lwp, WDataInP const rwp,
+                                 std::index_sequence<I...>) VL_PURE {
+    EData nequal = 0;
+    VL_WIDE_UNROLL_(nequal |= lwp[I] ^ rwp[I]);
+    return nequal;
+}
+template <std::size_t... I>
+static inline void _vl_add_w(WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                             QData carry, bool negr, std::index_sequence<I...>) VL_MT_SAFE {
+    // negr: add ~rwp, with carry in of 1, to subtract
+    VL_WIDE_UNROLL_((carry += static_cast<QData>(lwp[I])
+                              + static_cast<QData>(static_cast<EData>(negr ? ~rwp[I] : rwp[I])),
+                     owp[I] = static_cast<EData>(carry), carry >>= VL_EDATASIZE));
+}
+#ifdef VL_HAVE_ADDCARRY
+template <std::size_t... I>
+static inline unsigned char _vl_addc_w(WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                                       unsigned char cf, bool negr,
+                                       std::index_sequence<I...>) VL_MT_SAFE {
+    // As _vl_add_w, but on word pairs I through the carry flag; returns carry out
+    unsigned long long l, r, o;
+    VL_WIDE_UNROLL_((std::memcpy(&l, lwp + 2 * I, sizeof(l)),
+                     std::memcpy(&r, rwp + 2 * I, sizeof(r)),
+                     cf = _addcarry_u64(cf, l, negr ? ~r : r, &o),
+                     std::memcpy(owp + 2 * I, &o, sizeof(o))));
+    return cf;
+}
+#endif
+
+template <std::size_t N_Words>
+static inline WDataOutP VL_AND_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    _vl_and_w(owp, lwp, rwp, std::make_index_sequence<N_Words>{});
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_OR_W(WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    _vl_or_w(owp, lwp, rwp, std::make_index_sequence<N_Words>{});
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_XOR_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    _vl_xor_w(owp, lwp, rwp, std::make_index_sequence<N_Words>{});
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_NOT_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    _vl_not_w(owp, lwp, std::make_index_sequence<N_Words>{});
+    return owp;
+}
+template <std::size_t N_Words>
+static inline IData VL_EQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_nequal_w(lwp, rwp, std::make_index_sequence<N_Words>{}) == 0;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_ADD_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_ADDCARRY
+    const unsigned char cf
+        = _vl_addc_w(owp, lwp, rwp, 0, false, std::make_index_sequence<N_Words / 2>{});
+    if (N_Words & 1) owp[N_Words - 1] = lwp[N_Words - 1] + rwp[N_Words - 1] + cf;
+#else
+    _vl_add_w(owp, lwp, rwp, 0, false, std::make_index_sequence<N_Words>{});
+#endif
+    // Last output word is dirty
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_SUB_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_ADDCARRY
+    const unsigned char cf
+        = _vl_addc_w(owp, lwp, rwp, 1, true, std::make_index_sequence<N_Words / 2>{});
+    if (N_Words & 1) owp[N_Words - 1] = lwp[N_Words - 1] + ~rwp[N_Words - 1] + cf;
+#else
+    _vl_add_w(owp, lwp, rwp, 1, true, std::make_index_sequence<N_Words>{});
+#endif
+    // Last output word is dirty
+    return owp;
+}
+
 static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
+    // Larger multiplies use 64-bit limbs, see _vl_mul_w in verilated.cpp
+    if (words > 4) return _vl_mul_w(words, owp, lwp, rwp);
     for (int i = 0; i < words; ++i) owp[i] = 0;
     for (int lword = 0; lword < words; ++lword) {
-        for (int rword = 0; rword < words; ++rword) {
-            QData mul = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword]);
-            for (int qword = lword + rword; qword < words; ++qword) {
-                mul += static_cast<QData>(owp[qword]);
-                owp[qword] = (mul & 0xffffffffULL);
-                mul = (mul >> 32ULL) & 0xffffffffULL;
-            }
+        QData mul = 0;
+        for (int rword = 0; lword + rword < words; ++rword) {
+            mul += static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword])
+                   + static_cast<QData>(owp[lword + rword]);
+            owp[lword + rword] = static_cast<EData>(mul);
+            mul >>= VL_EDATASIZE;
         }
     }
     // Last output word is dirty
@@ -1953,6 +2302,32 @@ static inline QData VL_SHIFTR_QQQ(int obits, int, int, QData lhs, QData rhs) VL_
     if (VL_UNLIKELY(rhs >= VL_QUADSIZE)) return 0;
     return VL_CLEAN_QQ(obits, obits, lhs >> rhs);
 }
+// Vectorized middle words of a right shift by a non-zero bit offset, covering the
+// words whose upper source word is in range; returns the first word not computed
+static inline int _vl_shiftr_simd_w(WDataOutP owp, WDataInP const lwp, int words, int word_shift,
+                                    int owords, int loffset) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_SSE2
+    const int vwords = std::min(words, owords - word_shift - 1);
+    const __m128i lcount = _mm_cvtsi32_si128(loffset);
+    const __m128i rcount = _mm_cvtsi32_si128(VL_EDATASIZE - loffset);
+#ifdef VL_HAVE_AVX2
+    for (; i + 8 <= vwords; i += 8) {
+        const __m256i lo = _vl_simd_load256(lwp + word_shift + i);
+        const __m256i hi = _vl_simd_load256(lwp + word_shift + i + 1);
+        _vl_simd_store256(owp + i, _mm256_or_si256(_mm256_srl_epi32(lo, lcount),
+                                                   _mm256_sll_epi32(hi, rcount)));
+    }
+#endif
+    for (; i + 4 <= vwords; i += 4) {
+        const __m128i lo = _vl_simd_load128(lwp + word_shift + i);
+        const __m128i hi = _vl_simd_load128(lwp + word_shift + i + 1);
+        _vl_simd_store128(owp + i,
+                          _mm_or_si128(_mm_srl_epi32(lo, lcount), _mm_sll_epi32(hi, rcount)));
+    }
+#endif
+    return i;
+}
 static inline WDataOutP VL_SHIFTR_WWI(int obits, int, int, WDataOutP owp, WDataInP const lwp,
                                       IData rd) VL_MT_SAFE {
     const int word_shift = VL_BITWORD_E(rd);  // Maybe 0
@@ -1968,7 +2343,8 @@ static inline WDataOutP VL_SHIFTR_WWI(int obits, int, int, WDataOutP owp, WDataI
         const int nbitsonright = VL_EDATASIZE - loffset;  // bits that end up in lword (know
                                                           // loffset!=0) Middle words
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
+        for (int i = _vl_shiftr_simd_w(owp, lwp, words, word_shift, VL_WORDS_I(obits), loffset);
+             i < words; ++i) {
             owp[i] = lwp[i + word_shift] >> loffset;
             const int upperword = i + word_shift + 1;
             if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
@@ -2049,7 +2425,8 @@ static inline WDataOutP VL_SHIFTRS_WWI(int obits, int lbits, int, WDataOutP owp,
             = VL_EDATASIZE - loffset;  // bits that end up in lword (know loffset!=0)
         // Middle words
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
+        for (int i = _vl_shiftr_simd_w(owp, lwp, words, word_shift, VL_WORDS_I(obits), loffset);
+             i < words; ++i) {
             owp[i] = lwp[i + word_shift] >> loffset;
             const int upperword = i + word_shift + 1;
             if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
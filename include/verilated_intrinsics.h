@@ -38,6 +38,16 @@
 #  define VL_HAVE_AVX2 1
 #  include <immintrin.h>
 # endif
+# if defined(__AVX512F__) && defined(VL_HAVE_AVX2) && !defined(VL_DISABLE_AVX512)
+#  define VL_HAVE_AVX512 1
+# endif
+# if defined(__POPCNT__) && !defined(VL_DISABLE_POPCNT)
+#  define VL_HAVE_POPCNT 1
+# endif
+# if defined(__x86_64__) && defined(VL_HAVE_SSE2) && defined(__GNUC__)
+#  define VL_HAVE_ADDCARRY 1
+#  include <x86intrin.h>
+# endif
 #endif
 
 // clang-format on
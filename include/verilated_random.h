@@ -329,12 +329,13 @@ public:
             record_arr_table(var, name, dimension, {}, {});
         }
     }
-    template <typename T_Key, typename T_Value>
-    void write_var(VlAssocArray<T_Key, T_Value>& var, int width, const char* name, int dimension,
+    template <typename T_Key, typename T_Value, template <typename, typename> class T_Storage>
+    void write_var(VlAssocArray<T_Key, T_Value, T_Storage>& var, int width, const char* name,
+                   int dimension,
                    std::uint32_t randmodeIdx = std::numeric_limits<std::uint32_t>::max()) {
         if (m_vars.find(name) != m_vars.end()) return;
-        m_vars[name]
-            = std::make_shared<const VlRandomArrayVarTemplate<VlAssocArray<T_Key, T_Value>>>(
+        m_vars[name] = std::make_shared<
+            const VlRandomArrayVarTemplate<VlAssocArray<T_Key, T_Value, T_Storage>>>(
                 name, width, &var, dimension, randmodeIdx);
         if (dimension > 0) {
             idx = 0;
@@ -388,9 +389,10 @@ public:
             }
         }
     }
-    template <typename T_Key, typename T_Value>
-    void record_arr_table(VlAssocArray<T_Key, T_Value>& var, const std::string name, int dimension,
-                          std::vector<IData> indices, std::vector<size_t> idxWidths) {
+    template <typename T_Key, typename T_Value, template <typename, typename> class T_Storage>
+    void record_arr_table(VlAssocArray<T_Key, T_Value, T_Storage>& var, const std::string name,
+                          int dimension, std::vector<IData> indices,
+                          std::vector<size_t> idxWidths) {
         if ((dimension > 0) && (var.size() != 0)) {
             for (auto it = var.begin(); it != var.end(); ++it) {
                 const T_Key& key = it->first;
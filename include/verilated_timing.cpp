@@ -22,6 +22,89 @@
 
 #include "verilated_timing.h"
 
+//======================================================================
+// VlCoroutinePool:: Methods
+
+// Per-thread cache of freed blocks
+class VlCoroutinePoolCache final {
+public:
+    // CONSTANTS
+    static constexpr size_t GRANULE = 64;  // Size class granularity in bytes
+    static constexpr size_t CLASSES = 32;  // Number of size classes, larger blocks aren't pooled
+    static constexpr size_t MAX_FREE = 1024;  // Maximum number of cached blocks per class
+
+private:
+    // TYPES
+    struct FreeBlock final {
+        FreeBlock* m_nextp;  // Next free block of the same class
+    };
+    // MEMBERS
+    FreeBlock* m_freeps[CLASSES] = {};  // Free list for each size class
+    size_t m_freeCount[CLASSES] = {};  // Number of blocks in each free list
+
+public:
+    // CONSTRUCTORS
+    VlCoroutinePoolCache() = default;
+    ~VlCoroutinePoolCache();
+    // METHODS
+    static size_t sizeClass(size_t size) { return (size - 1) / GRANULE; }
+    void* allocate(size_t cls) {
+        FreeBlock* const blockp = m_freeps[cls];
+        if (VL_LIKELY(blockp)) {
+            m_freeps[cls] = blockp->m_nextp;
+            --m_freeCount[cls];
+            return blockp;
+        }
+        return ::operator new((cls + 1) * GRANULE);
+    }
+    void deallocate(void* ptr, size_t cls) {
+        if (VL_UNLIKELY(m_freeCount[cls] >= MAX_FREE)) {
+            ::operator delete(ptr);
+            return;
+        }
+        FreeBlock* const blockp = static_cast<FreeBlock*>(ptr);
+        blockp->m_nextp = m_freeps[cls];
+        m_freeps[cls] = blockp;
+        ++m_freeCount[cls];
+    }
+};
+
+// Set once this thread's cache is destroyed, e.g. when freeing frames from static destructors
+static thread_local bool t_coroutinePoolDead = false;
+
+VlCoroutinePoolCache::~VlCoroutinePoolCache() {
+    for (FreeBlock* blockp : m_freeps) {
+        while (blockp) {
+            FreeBlock* const nextp = blockp->m_nextp;
+            ::operator delete(blockp);
+            blockp = nextp;
+        }
+    }
+    t_coroutinePoolDead = true;
+}
+
+static VlCoroutinePoolCache& vlCoroutinePoolCache() {
+    static thread_local VlCoroutinePoolCache t_cache;
+    return t_cache;
+}
+
+void* VlCoroutinePool::allocate(size_t size) {
+    const size_t cls = VlCoroutinePoolCache::sizeClass(size);
+    if (VL_UNLIKELY(cls >= VlCoroutinePoolCache::CLASSES || t_coroutinePoolDead)) {
+        return ::operator new(size);
+    }
+    return vlCoroutinePoolCache().allocate(cls);
+}
+
+void VlCoroutinePool::deallocate(void* ptr, size_t size) noexcept {
+    const size_t cls = VlCoroutinePoolCache::sizeClass(size);
+    if (VL_UNLIKELY(cls >= VlCoroutinePoolCache::CLASSES || t_coroutinePoolDead)) {
+        ::operator delete(ptr);
+        return;
+    }
+    vlCoroutinePoolCache().deallocate(ptr, cls);
+}
+
 //======================================================================
 // VlCoroutineHandle:: Methods
 
@@ -53,16 +136,147 @@ void VlCoroutineHandle::dump() const {
 //======================================================================
 // VlDelayScheduler:: Methods
 
+// Index of the lowest set bit, v must be non-zero
+static inline int vlWheelLowestBit(uint64_t v) {
+#ifdef __GNUC__
+    return __builtin_ctzll(v);
+#else
+    int bit = 0;
+    while (!(v & 1)) {
+        v >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+void VlDelayScheduler::allocChunk() {
+    m_chunks.emplace_back(new Node[m_chunkSize]);
+    Node* const chunkp = m_chunks.back().get();
+    for (size_t i = 0; i < m_chunkSize; ++i) freeNode(&chunkp[i]);
+    if (m_chunkSize < 4096) m_chunkSize *= 2;
+}
+
+void VlDelayScheduler::link(Node* nodep) {
+    // Level is that of the highest bits where the time differs from the wheel's time
+    int level = 0;
+    for (uint64_t diff = (nodep->m_time ^ m_wheelTime) >> WHEEL_BITS; diff; diff >>= WHEEL_BITS)
+        ++level;
+    const int index = (nodep->m_time >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1);
+    Level& lvl = m_levels[level];
+    Slot& slot = lvl.m_slots[index];
+    nodep->m_nextp = nullptr;
+    if (slot.m_tailp) {
+        slot.m_tailp->m_nextp = nodep;
+    } else {
+        slot.m_headp = nodep;
+        lvl.m_occupied[index / 64] |= 1ULL << (index % 64);
+    }
+    slot.m_tailp = nodep;
+}
+
+void VlDelayScheduler::schedule(uint64_t time, VlCoroutineHandle&& handle) {
+    if (VL_UNLIKELY(time < m_wheelTime)) rewind(time);
+    Node* const nodep = allocNode();
+    nodep->m_time = time;
+    nodep->m_handle = std::move(handle);
+    link(nodep);
+    if (!m_size || time < m_nextTime) m_nextTime = time;
+    ++m_size;
+}
+
+void VlDelayScheduler::advance(uint64_t time) {
+    m_wheelTime = time;
+    // The slot for the new time on each level now holds nodes which differ from the wheel time
+    // only in lower bits, so move them down, top level first
+    for (int level = WHEEL_LEVELS - 1; level > 0; --level) {
+        const int index = (time >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1);
+        Level& lvl = m_levels[level];
+        uint64_t& occupied = lvl.m_occupied[index / 64];
+        const uint64_t bit = 1ULL << (index % 64);
+        if (!(occupied & bit)) continue;
+        occupied &= ~bit;
+        Slot& slot = lvl.m_slots[index];
+        Node* nodep = slot.m_headp;
+        slot.m_headp = slot.m_tailp = nullptr;
+        while (nodep) {
+            Node* const nextp = nodep->m_nextp;
+            link(nodep);
+            nodep = nextp;
+        }
+    }
+}
+
+uint64_t VlDelayScheduler::findNextTime() const {
+    // All times on a level are before all times on higher levels, and
+    // all times in a slot are before all times in higher slots
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+        const Level& lvl = m_levels[level];
+        for (int word = 0; word < WHEEL_MAPWORDS; ++word) {
+            if (!lvl.m_occupied[word]) continue;
+            const int index = word * 64 + vlWheelLowestBit(lvl.m_occupied[word]);
+            const Slot& slot = lvl.m_slots[index];
+            if (level == 0) return slot.m_headp->m_time;  // All nodes have the same time
+            uint64_t earliest = slot.m_headp->m_time;
+            for (const Node* nodep = slot.m_headp->m_nextp; nodep; nodep = nodep->m_nextp) {
+                if (nodep->m_time < earliest) earliest = nodep->m_time;
+            }
+            return earliest;
+        }
+    }
+    return ~0ULL;
+}
+
+std::vector<VlDelayScheduler::Node*> VlDelayScheduler::sortedNodes() const {
+    std::vector<Node*> nodeps;
+    nodeps.reserve(m_size);
+    for (const Level& lvl : m_levels) {
+        for (const Slot& slot : lvl.m_slots) {
+            for (Node* nodep = slot.m_headp; nodep; nodep = nodep->m_nextp) {
+                nodeps.push_back(nodep);
+            }
+        }
+    }
+    // Nodes with equal times are in one slot in scheduling order, so a stable sort keeps it
+    std::stable_sort(nodeps.begin(), nodeps.end(),
+                     [](const Node* ap, const Node* bp) { return ap->m_time < bp->m_time; });
+    return nodeps;
+}
+
+void VlDelayScheduler::rewind(uint64_t time) {
+    // Only if the simulation time was moved backwards; rebuild the wheel from scratch
+    const std::vector<Node*> nodeps = sortedNodes();
+    for (Level& lvl : m_levels) lvl = Level{};
+    m_wheelTime = time;
+    for (Node* const nodep : nodeps) link(nodep);
+}
+
 void VlDelayScheduler::resume() {
 #ifdef VL_DEBUG
     VL_DEBUG_IF(dump(); VL_DBG_MSGF("         Resuming delayed processes\n"););
 #endif
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
+    const uint64_t time = m_context.time();
+    if (m_size && m_nextTime == time) {
+        advance(time);
+        // All nodes for the current time are now in a single level 0 slot. Take them all before
+        // resuming any, as resumed coroutines may schedule themselves again.
+        const int index = time & (WHEEL_SLOTS - 1);
+        Level& lvl = m_levels[0];
+        lvl.m_occupied[index / 64] &= ~(1ULL << (index % 64));
+        Slot& slot = lvl.m_slots[index];
+        Node* nodep = slot.m_headp;
+        slot.m_headp = slot.m_tailp = nullptr;
+        m_nextTime = findNextTime();
+        while (nodep) {
+            Node* const nextp = nodep->m_nextp;
+            VlCoroutineHandle handle = std::move(nodep->m_handle);
+            freeNode(nodep);
+            --m_size;
+            handle.resume();
+            nodep = nextp;
+        }
         resumed = true;
     }
 
@@ -87,7 +301,7 @@ void VlDelayScheduler::resume() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (m_size) return m_nextTime;
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
     return m_context.time();
@@ -95,7 +309,7 @@ uint64_t VlDelayScheduler::nextTimeSlot() const {
 
 #ifdef VL_DEBUG
 void VlDelayScheduler::dump() const {
-    if (m_queue.empty()) {
+    if (!m_size) {
         VL_DBG_MSGF("         No delayed processes:\n");
     } else {
         VL_DBG_MSGF("         Delayed processes:\n");
@@ -105,9 +319,9 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
+        for (const Node* const nodep : sortedNodes()) {
+            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", nodep->m_time);
+            nodep->m_handle.dump();
         }
     }
 }
@@ -221,7 +435,12 @@ void VlDynamicTriggerScheduler::dump() const {
 void VlForkSync::done(const char* filename, int lineno) {
     VL_DEBUG_IF(VL_DBG_MSGF("             Process forked at %s:%d finished\n", filename, lineno););
     if (m_join->m_counter > 0) m_join->m_counter--;
-    if (m_join->m_counter == 0) m_join->m_susp.resume();
+    if (m_join->m_counter == 0) {
+        // Take the handle first, as the resumed process may init() this fork again, freeing the
+        // join state before resume() returns
+        VlCoroutineHandle susp = std::move(m_join->m_susp);
+        susp.resume();
+    }
 }
 
 //======================================================================
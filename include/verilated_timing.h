@@ -27,6 +27,7 @@
 
 #include "verilated.h"
 
+#include <memory>
 #include <vector>
 
 // clang-format off
@@ -92,6 +93,43 @@ public:
 #endif
 };
 
+//=============================================================================
+// VlCoroutinePool recycles coroutine frames and fork join states. Freed blocks are kept in
+// per-thread free lists, one for each size class, so allocating them again does not go through
+// the global heap. Blocks may be freed on a different thread than the one that allocated them.
+
+class VlCoroutinePool final {
+public:
+    // METHODS
+    // Allocate a block of the given size
+    static void* allocate(size_t size);
+    // Free a block allocated with allocate(), size must be the same as when allocated
+    static void deallocate(void* ptr, size_t size) noexcept;
+};
+
+// Allocator for std::allocate_shared and containers using VlCoroutinePool
+template <typename T_Value>
+struct VlCoroutinePoolAllocator final {
+    using value_type = T_Value;
+    VlCoroutinePoolAllocator() = default;
+    template <typename T_Other>
+    VlCoroutinePoolAllocator(const VlCoroutinePoolAllocator<T_Other>&) {}
+    T_Value* allocate(size_t n) {
+        return static_cast<T_Value*>(VlCoroutinePool::allocate(n * sizeof(T_Value)));
+    }
+    void deallocate(T_Value* ptr, size_t n) noexcept {
+        VlCoroutinePool::deallocate(ptr, n * sizeof(T_Value));
+    }
+    template <typename T_Other>
+    bool operator==(const VlCoroutinePoolAllocator<T_Other>&) const {
+        return true;
+    }
+    template <typename T_Other>
+    bool operator!=(const VlCoroutinePoolAllocator<T_Other>&) const {
+        return false;
+    }
+};
+
 //=============================================================================
 // VlCoroutineHandle is a non-copyable (but movable) coroutine handle. On resume, the handle is
 // cleared, as we assume that either the coroutine has finished and deleted itself, or, if it got
@@ -159,24 +197,82 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
+//
+// Delayed coroutines are kept in a hierarchical timing wheel. Level L has a slot for each value
+// of bits [L*8, L*8+8) of the resume time, and holds the coroutines whose resume time first
+// differs from the wheel's time in those bits. Scheduling is O(1), and near-future delays go
+// straight into level 0. When the wheel advances to a new time, the slot of that time on each
+// higher level is cascaded down into the lower levels. Coroutines with the same resume time are
+// always in the same slot, in the order they were scheduled.
 
 class VlDelayScheduler final {
     // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
+    // Delayed coroutine, kept in a slot list, or in the free list when unused
+    struct Node final {
+        uint64_t m_time = 0;  // Simulation time to resume at
+        Node* m_nextp = nullptr;  // Next node in the same list
+        VlCoroutineHandle m_handle{nullptr};  // The delayed coroutine
+    };
+    // FIFO list of nodes with the same slot index
+    struct Slot final {
+        Node* m_headp = nullptr;
+        Node* m_tailp = nullptr;
+    };
+    static constexpr int WHEEL_BITS = 8;  // Log2 of the number of slots per level
+    static constexpr int WHEEL_SLOTS = 1 << WHEEL_BITS;  // Number of slots per level
+    static constexpr int WHEEL_LEVELS = 64 / WHEEL_BITS;  // Number of levels to cover uint64_t
+    static constexpr int WHEEL_MAPWORDS = WHEEL_SLOTS / 64;  // Words in the occupancy bitmap
+    struct Level final {
+        Slot m_slots[WHEEL_SLOTS];  // Slot for each value of this level's time bits
+        uint64_t m_occupied[WHEEL_MAPWORDS] = {};  // Bitmap of non-empty slots
+    };
 
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    std::vector<Level> m_levels;  // Timing wheel, one entry per level
+    uint64_t m_wheelTime = 0;  // Time the wheel is positioned at, no node is earlier
+    uint64_t m_nextTime = 0;  // Earliest resume time in the wheel, valid if m_size != 0
+    size_t m_size = 0;  // Number of coroutines in the wheel
+    Node* m_freep = nullptr;  // List of unused nodes
+    std::vector<std::unique_ptr<Node[]>> m_chunks;  // Storage for the nodes
+    size_t m_chunkSize = 64;  // Number of nodes in the next chunk allocated
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
                                                       // reallocation.
 
+    // METHODS
+    // Add a coroutine to be resumed at the given time
+    void schedule(uint64_t time, VlCoroutineHandle&& handle);
+    // Link a node into its slot relative to the current wheel time
+    void link(Node* nodep);
+    // Move the wheel to the given time, which must not be after any node's time
+    void advance(uint64_t time);
+    // Earliest resume time in the wheel, or ~0 if empty
+    uint64_t findNextTime() const;
+    // Move the wheel back to the given time, which is before the current wheel time
+    void rewind(uint64_t time);
+    // All nodes in the wheel, sorted by resume time, in order of scheduling for equal times
+    std::vector<Node*> sortedNodes() const;
+    // Get an unused node
+    Node* allocNode() {
+        if (VL_UNLIKELY(!m_freep)) allocChunk();
+        Node* const nodep = m_freep;
+        m_freep = nodep->m_nextp;
+        return nodep;
+    }
+    void allocChunk();
+    // Return an unused node
+    void freeNode(Node* nodep) {
+        nodep->m_nextp = m_freep;
+        m_freep = nodep;
+    }
+
 public:
     // CONSTRUCTORS
     explicit VlDelayScheduler(VerilatedContext& context)
-        : m_context{context} {}
+        : m_context{context}
+        , m_levels(WHEEL_LEVELS) {}
     // METHODS
     // Resume coroutines waiting for the current simulation time
     void resume();
@@ -184,11 +280,10 @@ public:
     // coroutines)
     uint64_t nextTimeSlot() const;
     // Are there no delayed coroutines awaiting?
-    bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
+    bool empty() const { return !m_size && m_zeroDelayed.empty(); }
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
-        return (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
-               || !m_zeroDelayed.empty();
+        return (m_size && (m_nextTime <= m_context.time())) || !m_zeroDelayed.empty();
     }
 #ifdef VL_DEBUG
     void dump() const;
@@ -198,8 +293,7 @@ public:
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
-            std::vector<VlCoroutineHandle>& queueZeroDelay;
+            VlDelayScheduler& scheduler;
             const uint64_t delay;
             const VlDelayPhase phase;
             const VlFileLineDebug fileline;
@@ -207,9 +301,10 @@ public:
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    scheduler.schedule(delay, VlCoroutineHandle{coro, process, fileline});
                 } else {
-                    queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
+                    scheduler.m_zeroDelayed.emplace_back(
+                        VlCoroutineHandle{coro, process, fileline});
                 }
             }
             void await_resume() const {}
@@ -224,9 +319,8 @@ public:
         }
 #endif
 
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process, *this, m_context.time() + delay, phase,
+                         VlFileLineDebug{filename, lineno}};
     }
 };
 
@@ -384,6 +478,9 @@ class VlForkSync final {
     struct VlJoin final {
         size_t m_counter = 0;  // When reaches 0, resume suspended coroutine
         VlCoroutineHandle m_susp;  // Coroutine to resume
+        VlJoin(size_t counter, VlProcessRef process)
+            : m_counter{counter}
+            , m_susp{process} {}
     };
 
     // The join info is shared among all forked processes
@@ -391,7 +488,9 @@ class VlForkSync final {
 
 public:
     // Create the join object and set the counter to the specified number
-    void init(size_t count, VlProcessRef process) { m_join.reset(new VlJoin{count, {process}}); }
+    void init(size_t count, VlProcessRef process) {
+        m_join = std::allocate_shared<VlJoin>(VlCoroutinePoolAllocator<VlJoin>{}, count, process);
+    }
     // Called whenever any of the forked processes finishes. If the join counter reaches 0, the
     // main process gets resumed
     void done(const char* filename = VL_UNKNOWN, int lineno = 0);
@@ -428,6 +527,12 @@ private:
 
         ~VlPromise();
 
+        // Coroutine frames come from the pool, as processes are created and finish often
+        static void* operator new(size_t size) { return VlCoroutinePool::allocate(size); }
+        static void operator delete(void* ptr, size_t size) noexcept {
+            VlCoroutinePool::deallocate(ptr, size);
+        }
+
         VlCoroutine get_return_object() { return {this}; }
 
         // Never suspend at the start of the coroutine
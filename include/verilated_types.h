@@ -32,11 +32,13 @@
 #include <array>
 #include <atomic>
 #include <deque>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 //=========================================================================
 // Debug functions
@@ -471,6 +473,303 @@ std::string VL_TO_STRING(const VlWide<N_Words>& obj) {
     return VL_TO_STRING_W(N_Words, obj.data());
 }
 
+//===================================================================
+// Ring buffer storage for VlQueue
+// Elements are held in fixed-size chunks that form a ring of positions, so
+// pushing or popping at either end and indexing are a masked lookup.
+// Growing only adds chunks, and elements never move, so references to
+// elements stay valid as the queue grows, as they did with std::deque.
+// Bounded queues whose bound fits are stored inline in a single chunk
+// without any heap allocation.
+// There are no multithreaded locks on this; the base variable must
+// be protected by other means
+
+template <typename T_Value, size_t N_Size>
+struct VlQueueInline final {
+    alignas(T_Value) unsigned char m_storage[N_Size * sizeof(T_Value)];
+};
+template <typename T_Value>
+struct VlQueueInline<T_Value, 0> final {};
+
+template <typename T_Value, size_t N_MaxSize>
+class VlQueueBuffer final {
+    // CONSTANTS
+    static constexpr size_t CHUNK_BYTES = 512;  // Size of each heap allocated chunk
+    static constexpr size_t FIXED_BYTES = 512;  // Largest bounded queue stored wholly inline
+
+    static constexpr size_t pow2Ceil(size_t n) { return n <= 1 ? 1 : 2 * pow2Ceil((n + 1) / 2); }
+    static constexpr size_t pow2Floor(size_t n) { return n <= 1 ? 1 : 2 * pow2Floor(n / 2); }
+    static constexpr unsigned log2(size_t n) { return n <= 1 ? 0 : 1 + log2(n / 2); }
+
+public:
+    // Capacity that covers the queue's bound, or zero if unbounded
+    static constexpr size_t FIXED_CAPACITY = N_MaxSize ? pow2Ceil(N_MaxSize) : 0;
+    // Number of elements stored inline, either all of them or zero
+    static constexpr size_t INLINE_CAPACITY
+        = (FIXED_CAPACITY && FIXED_CAPACITY * sizeof(T_Value) <= FIXED_BYTES) ? FIXED_CAPACITY : 0;
+    // Number of elements in each heap allocated chunk
+    static constexpr size_t CHUNK_CAPACITY = pow2Floor(CHUNK_BYTES / sizeof(T_Value));
+
+private:
+    static constexpr unsigned CHUNK_BITS = log2(CHUNK_CAPACITY);
+
+public:
+    // TYPES
+    template <typename T_Buffer, typename T_Elem>
+    class Iterator final {
+        T_Buffer* m_bufp = nullptr;  // Buffer iterated over
+        size_t m_index = 0;  // Logical index into buffer
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T_Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T_Elem*;
+        using reference = T_Elem&;
+
+        Iterator() = default;
+        Iterator(T_Buffer* bufp, size_t index)
+            : m_bufp{bufp}
+            , m_index{index} {}
+
+        reference operator*() const { return (*m_bufp)[m_index]; }
+        pointer operator->() const { return &(*m_bufp)[m_index]; }
+        reference operator[](difference_type n) const { return (*m_bufp)[m_index + n]; }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            const Iterator it = *this;
+            ++m_index;
+            return it;
+        }
+        Iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+        Iterator operator--(int) {
+            const Iterator it = *this;
+            --m_index;
+            return it;
+        }
+        Iterator& operator+=(difference_type n) {
+            m_index += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            m_index -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const { return Iterator{m_bufp, m_index + n}; }
+        Iterator operator-(difference_type n) const { return Iterator{m_bufp, m_index - n}; }
+        friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        difference_type operator-(const Iterator& rhs) const {
+            return static_cast<difference_type>(m_index - rhs.m_index);
+        }
+        bool operator==(const Iterator& rhs) const { return m_index == rhs.m_index; }
+        bool operator!=(const Iterator& rhs) const { return m_index != rhs.m_index; }
+        bool operator<(const Iterator& rhs) const { return m_index < rhs.m_index; }
+        bool operator>(const Iterator& rhs) const { return m_index > rhs.m_index; }
+        bool operator<=(const Iterator& rhs) const { return m_index <= rhs.m_index; }
+        bool operator>=(const Iterator& rhs) const { return m_index >= rhs.m_index; }
+    };
+    using iterator = Iterator<VlQueueBuffer, T_Value>;
+    using const_iterator = Iterator<const VlQueueBuffer, const T_Value>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    // MEMBERS
+    VlQueueInline<T_Value, INLINE_CAPACITY> m_inline;  // Storage if all elements are inline
+    T_Value** m_chunkps = nullptr;  // Ring of heap chunks, each nullptr until first used
+    size_t m_chunks = 0;  // Number of chunks in ring, zero or a power of two
+    size_t m_capacity = INLINE_CAPACITY;  // Elements held without growing, see grow()
+    size_t m_head = 0;  // Ring position of first element
+    size_t m_size = 0;  // Number of elements
+
+public:
+    // CONSTRUCTORS
+    VlQueueBuffer() = default;
+    ~VlQueueBuffer() {
+        clear();
+        release();
+    }
+    VlQueueBuffer(const VlQueueBuffer& rhs) { append(rhs); }
+    VlQueueBuffer(VlQueueBuffer&& rhs) noexcept { take(rhs); }
+    VlQueueBuffer& operator=(const VlQueueBuffer& rhs) {
+        if (this != &rhs) {
+            clear();
+            append(rhs);
+        }
+        return *this;
+    }
+    VlQueueBuffer& operator=(VlQueueBuffer&& rhs) noexcept {
+        if (this != &rhs) {
+            clear();
+            release();
+            take(rhs);
+        }
+        return *this;
+    }
+    bool operator==(const VlQueueBuffer& rhs) const {
+        return m_size == rhs.m_size && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const VlQueueBuffer& rhs) const { return !(*this == rhs); }
+
+private:
+    // METHODS
+    // Number of ring positions, a power of two once there is storage
+    size_t positions() const { return INLINE_CAPACITY ? INLINE_CAPACITY : m_chunks << CHUNK_BITS; }
+    size_t position(size_t index) const { return (m_head + index) & (positions() - 1); }
+    // Address of inline storage, only a sentinel if INLINE_CAPACITY is zero
+    T_Value* inlinep() const {
+        return reinterpret_cast<T_Value*>(const_cast<decltype(m_inline)*>(&m_inline));
+    }
+    T_Value* slotp(size_t index) const {
+        const size_t pos = position(index);
+        if (INLINE_CAPACITY) return inlinep() + pos;
+        return m_chunkps[pos >> CHUNK_BITS] + (pos & (CHUNK_CAPACITY - 1));
+    }
+    // Return storage for a new element at index, allocating its chunk if first used
+    T_Value* newSlotp(size_t index) {
+        if (INLINE_CAPACITY) return slotp(index);
+        const size_t pos = position(index);
+        T_Value*& chunkp = m_chunkps[pos >> CHUNK_BITS];
+        if (VL_UNLIKELY(!chunkp)) chunkp = std::allocator<T_Value>{}.allocate(CHUNK_CAPACITY);
+        return chunkp + (pos & (CHUNK_CAPACITY - 1));
+    }
+    // Double the ring of chunks until minCapacity fits. One chunk's worth of positions
+    // is kept spare, so the last element is never in the first element's chunk. The
+    // ring can then be rotated to start at the first element's chunk, and the elements
+    // stay where they are. VlQueue keeps bounded queues within their bound, so inline
+    // storage never grows.
+    VL_ATTR_NOINLINE void grow(size_t minCapacity) {
+        size_t chunks = m_chunks ? m_chunks * 2 : 2;
+        while (((chunks - 1) << CHUNK_BITS) < minCapacity) chunks *= 2;
+        T_Value** const newps = new T_Value*[chunks]();
+        const size_t first = m_head >> CHUNK_BITS;
+        for (size_t i = 0; i < m_chunks; ++i) newps[i] = m_chunkps[(first + i) & (m_chunks - 1)];
+        delete[] m_chunkps;
+        m_chunkps = newps;
+        m_chunks = chunks;
+        m_capacity = (chunks - 1) << CHUNK_BITS;
+        m_head &= CHUNK_CAPACITY - 1;
+    }
+    // Free all chunks, must be empty
+    void release() {
+        for (size_t i = 0; i < m_chunks; ++i) {
+            if (m_chunkps[i]) std::allocator<T_Value>{}.deallocate(m_chunkps[i], CHUNK_CAPACITY);
+        }
+        delete[] m_chunkps;
+        m_chunkps = nullptr;
+        m_chunks = 0;
+        m_capacity = INLINE_CAPACITY;
+        m_head = 0;
+    }
+    // Take elements of rhs, must be empty with no chunks
+    void take(VlQueueBuffer& rhs) {
+        if (INLINE_CAPACITY) {
+            for (size_t i = 0; i < rhs.m_size; ++i) new (slotp(i)) T_Value(std::move(rhs[i]));
+            m_size = rhs.m_size;
+            rhs.clear();
+        } else {
+            m_chunkps = rhs.m_chunkps;
+            m_chunks = rhs.m_chunks;
+            m_capacity = rhs.m_capacity;
+            m_head = rhs.m_head;
+            m_size = rhs.m_size;
+            rhs.m_chunkps = nullptr;
+            rhs.m_chunks = 0;
+            rhs.m_capacity = 0;
+            rhs.m_head = 0;
+            rhs.m_size = 0;
+        }
+    }
+    void append(const VlQueueBuffer& rhs) {
+        reserve(m_size + rhs.m_size);
+        for (size_t i = 0; i < rhs.m_size; ++i) new (newSlotp(m_size++)) T_Value(rhs[i]);
+    }
+
+public:
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    void reserve(size_t size) {
+        if (VL_UNLIKELY(size > m_capacity)) grow(size);
+    }
+
+    // Accessing, index must be in range
+    T_Value& operator[](size_t index) { return *slotp(index); }
+    const T_Value& operator[](size_t index) const { return *slotp(index); }
+    T_Value& front() { return (*this)[0]; }
+    T_Value& back() { return (*this)[m_size - 1]; }
+
+    void push_back(const T_Value& value) {
+        // Growing moves no elements, so value may be an element
+        reserve(m_size + 1);
+        new (newSlotp(m_size)) T_Value(value);
+        ++m_size;
+    }
+    void push_front(const T_Value& value) {
+        reserve(m_size + 1);
+        m_head = (m_head - 1) & (positions() - 1);
+        new (newSlotp(0)) T_Value(value);
+        ++m_size;
+    }
+    void pop_front() {
+        front().~T_Value();
+        m_head = (m_head + 1) & (positions() - 1);
+        --m_size;
+    }
+    void pop_back() {
+        back().~T_Value();
+        --m_size;
+    }
+    // Destroy elements, keeping chunks for reuse
+    void clear() {
+        for (size_t i = 0; i < m_size; ++i) slotp(i)->~T_Value();
+        m_head = 0;
+        m_size = 0;
+    }
+    // Resize, value must not be an element
+    void resize(size_t size, const T_Value& value) {
+        while (m_size > size) pop_back();
+        reserve(size);
+        while (m_size < size) new (newSlotp(m_size++)) T_Value(value);
+    }
+    // Insert before index, shifting whichever side is shorter
+    void insert(size_t index, const T_Value& value) {
+        if (index < m_size / 2) {
+            push_front(value);
+            for (size_t i = 0; i < index; ++i) std::swap((*this)[i], (*this)[i + 1]);
+        } else {
+            push_back(value);
+            for (size_t i = m_size - 1; i > index; --i) std::swap((*this)[i], (*this)[i - 1]);
+        }
+    }
+    // Erase at index, shifting whichever side is shorter
+    void erase(size_t index) {
+        if (index < m_size / 2) {
+            for (size_t i = index; i > 0; --i) (*this)[i] = std::move((*this)[i - 1]);
+            pop_front();
+        } else {
+            for (size_t i = index; i + 1 < m_size; ++i) (*this)[i] = std::move((*this)[i + 1]);
+            pop_back();
+        }
+    }
+
+    iterator begin() { return iterator{this, 0}; }
+    iterator end() { return iterator{this, m_size}; }
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, m_size}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+};
+
 //===================================================================
 // Verilog queue and dynamic array container
 // There are no multithreaded locks on this; the base variable must
@@ -482,16 +781,16 @@ template <typename T_Value, size_t N_MaxSize = 0>
 class VlQueue final {
 private:
     // TYPES
-    using Deque = std::deque<T_Value>;
+    using Buffer = VlQueueBuffer<T_Value, N_MaxSize>;
 
 public:
-    using const_iterator = typename Deque::const_iterator;
+    using const_iterator = typename Buffer::const_iterator;
     template <typename T_Func>
     using WithFuncReturnType = decltype(std::declval<T_Func>()(0, std::declval<T_Value>()));
 
 private:
     // MEMBERS
-    Deque m_deque;  // State of the assoc array
+    Buffer m_buf;  // State of the queue
     T_Value m_defaultValue;  // Default value
 
 public:
@@ -503,11 +802,11 @@ public:
     VlQueue(VlQueue&&) = default;
     VlQueue& operator=(const VlQueue&) = default;
     VlQueue& operator=(VlQueue&&) = default;
-    bool operator==(const VlQueue& rhs) const { return m_deque == rhs.m_deque; }
-    bool operator!=(const VlQueue& rhs) const { return m_deque != rhs.m_deque; }
+    bool operator==(const VlQueue& rhs) const { return m_buf == rhs.m_buf; }
+    bool operator!=(const VlQueue& rhs) const { return m_buf != rhs.m_buf; }
     bool operator<(const VlQueue& rhs) const {
-        for (int index = 0; index < m_deque.size(); ++index) {
-            if (m_deque[index] < rhs.m_deque[index]) return true;
+        for (size_t index = 0; index < m_buf.size() && index < rhs.m_buf.size(); ++index) {
+            if (m_buf[index] < rhs.m_buf[index]) return true;
         }
         return false;
     }
@@ -516,8 +815,14 @@ public:
     // Also must allow conversion from a different N_MaxSize queue
     template <size_t N_RhsMaxSize = 0>
     VlQueue operator=(const VlQueue<T_Value, N_RhsMaxSize>& rhs) {
-        m_deque = rhs.privateDeque();
-        if (VL_UNLIKELY(N_MaxSize && N_MaxSize < m_deque.size())) m_deque.resize(N_MaxSize - 1);
+        // A bounded queue keeps the elements that fit, and ignores the rest
+        const size_t size = N_MaxSize ? std::min<size_t>(rhs.size(), N_MaxSize) : rhs.size();
+        m_buf.clear();
+        m_buf.reserve(size);
+        for (const T_Value& i : rhs) {
+            if (m_buf.size() == size) break;
+            m_buf.push_back(i);
+        }
         return *this;
     }
 
@@ -545,28 +850,26 @@ public:
     }
     static VlQueue consCC(const VlQueue& lhs, const VlQueue& rhs) {
         VlQueue out = rhs;
-        for (const auto& i : lhs.m_deque) out.push_back(i);
+        for (const auto& i : lhs.m_buf) out.push_back(i);
         return out;
     }
 
     // METHODS
     T_Value& atDefault() { return m_defaultValue; }
     const T_Value& atDefault() const { return m_defaultValue; }
-    const Deque& privateDeque() const { return m_deque; }
 
     // Size. Verilog: function int size(), or int num()
-    int size() const { return m_deque.size(); }
+    int size() const { return m_buf.size(); }
     // Clear array. Verilog: function void delete([input index])
-    void clear() { m_deque.clear(); }
+    void clear() { m_buf.clear(); }
     void erase(int32_t index) {
-        if (VL_LIKELY(index >= 0 && index < m_deque.size()))
-            m_deque.erase(m_deque.begin() + index);
+        if (VL_LIKELY(index >= 0 && index < m_buf.size())) m_buf.erase(index);
     }
 
     // Dynamic array new[] becomes a renew()
     void renew(size_t size) {
         clear();
-        m_deque.resize(size, atDefault());
+        m_buf.resize(size, atDefault());
     }
     // Dynamic array new[]() becomes a renew_copy()
     void renew_copy(size_t size, const VlQueue<T_Value, N_MaxSize>& rhs) {
@@ -574,32 +877,38 @@ public:
             clear();
         } else {
             *this = rhs;
-            m_deque.resize(size, atDefault());
+            m_buf.resize(size, atDefault());
         }
     }
-    void resize(size_t size) { m_deque.resize(size, atDefault()); }
+    void resize(size_t size) { m_buf.resize(size, atDefault()); }
 
     // function void q.push_front(value)
     void push_front(const T_Value& value) {
-        m_deque.push_front(value);
-        if (VL_UNLIKELY(N_MaxSize != 0 && m_deque.size() > N_MaxSize)) m_deque.pop_back();
+        // Drop from the back first, so a bounded queue never exceeds its capacity
+        if (VL_UNLIKELY(N_MaxSize != 0 && m_buf.size() >= N_MaxSize)) {
+            T_Value copy(value);  // Value may be the dropped element
+            m_buf.pop_back();
+            m_buf.push_front(copy);
+            return;
+        }
+        m_buf.push_front(value);
     }
     // function void q.push_back(value)
     void push_back(const T_Value& value) {
-        if (VL_LIKELY(N_MaxSize == 0 || m_deque.size() < N_MaxSize)) m_deque.push_back(value);
+        if (VL_LIKELY(N_MaxSize == 0 || m_buf.size() < N_MaxSize)) m_buf.push_back(value);
     }
     // function value_t q.pop_front();
     T_Value pop_front() {
-        if (m_deque.empty()) return m_defaultValue;
-        T_Value v = m_deque.front();
-        m_deque.pop_front();
+        if (m_buf.empty()) return m_defaultValue;
+        T_Value v = std::move(m_buf.front());
+        m_buf.pop_front();
         return v;
     }
     // function value_t q.pop_back();
     T_Value pop_back() {
-        if (m_deque.empty()) return m_defaultValue;
-        T_Value v = m_deque.back();
-        m_deque.pop_back();
+        if (m_buf.empty()) return m_defaultValue;
+        T_Value v = std::move(m_buf.back());
+        m_buf.pop_back();
         return v;
     }
 
@@ -608,93 +917,103 @@ public:
         // cppcheck-suppress variableScope
         static thread_local T_Value t_throwAway;
         // Needs to work for dynamic arrays, so does not use N_MaxSize
-        if (VL_UNLIKELY(index < 0 || index >= m_deque.size())) {
+        if (VL_UNLIKELY(index < 0 || index >= m_buf.size())) {
             t_throwAway = atDefault();
             return t_throwAway;
         }
-        return m_deque[index];
+        return m_buf[index];
     }
     // Setting. Verilog: assoc[index] = v (should only be used by queues)
     T_Value& atWriteAppend(int32_t index) {
         // cppcheck-suppress variableScope
         static thread_local T_Value t_throwAway;
-        if (VL_UNLIKELY(index < 0 || index > m_deque.size())) {
+        if (VL_UNLIKELY(index < 0 || index > m_buf.size()
+                        || (index == m_buf.size() && N_MaxSize != 0 && index >= N_MaxSize))) {
+            // Out of range, or appending to a full bounded queue
             t_throwAway = atDefault();
             return t_throwAway;
-        } else if (VL_UNLIKELY(index == m_deque.size())) {
+        } else if (VL_UNLIKELY(index == m_buf.size())) {
             push_back(atDefault());
         }
-        return m_deque[index];
+        return m_buf[index];
     }
     // Accessing. Verilog: v = assoc[index]
     const T_Value& at(int32_t index) const {
         // Needs to work for dynamic arrays, so does not use N_MaxSize
-        if (VL_UNLIKELY(index < 0 || index >= m_deque.size())) {
+        if (VL_UNLIKELY(index < 0 || index >= m_buf.size())) {
             return atDefault();
         } else {
-            return m_deque[index];
+            return m_buf[index];
         }
     }
     // Access with an index counted from end (e.g. q[$])
-    T_Value& atWriteAppendBack(int32_t index) { return atWriteAppend(m_deque.size() - 1 - index); }
-    const T_Value& atBack(int32_t index) const { return at(m_deque.size() - 1 - index); }
+    T_Value& atWriteAppendBack(int32_t index) { return atWriteAppend(m_buf.size() - 1 - index); }
+    const T_Value& atBack(int32_t index) const { return at(m_buf.size() - 1 - index); }
 
     // function void q.insert(index, value);
     void insert(int32_t index, const T_Value& value) {
-        if (VL_UNLIKELY(index < 0 || index > m_deque.size())) return;
-        m_deque.insert(m_deque.begin() + index, value);
+        if (VL_UNLIKELY(index < 0 || index > m_buf.size())) return;
+        // A full bounded queue drops its last element, as with push_front
+        if (VL_UNLIKELY(N_MaxSize != 0 && m_buf.size() >= N_MaxSize)) {
+            if (index == m_buf.size()) return;
+            T_Value copy(value);  // Value may be the dropped element
+            m_buf.pop_back();
+            m_buf.insert(index, copy);
+            return;
+        }
+        m_buf.insert(index, value);
     }
 
     // inside (set membership operator)
     bool inside(const T_Value& value) const {
-        return std::find(m_deque.cbegin(), m_deque.cend(), value) != m_deque.cend();
+        return std::find(m_buf.cbegin(), m_buf.cend(), value) != m_buf.cend();
     }
 
     // Return slice q[lsb:msb]
     VlQueue slice(int32_t lsb, int32_t msb) const {
         VlQueue out;
         if (VL_UNLIKELY(lsb < 0)) lsb = 0;
-        if (VL_UNLIKELY(lsb >= m_deque.size())) lsb = m_deque.size() - 1;
-        if (VL_UNLIKELY(msb >= m_deque.size())) msb = m_deque.size() - 1;
-        for (int32_t i = lsb; i <= msb; ++i) out.push_back(m_deque[i]);
+        if (VL_UNLIKELY(lsb >= m_buf.size())) lsb = m_buf.size() - 1;
+        if (VL_UNLIKELY(msb >= m_buf.size())) msb = m_buf.size() - 1;
+        for (int32_t i = lsb; i <= msb; ++i) out.push_back(m_buf[i]);
         return out;
     }
     VlQueue sliceFrontBack(int32_t lsb, int32_t msb) const {
-        return slice(lsb, m_deque.size() - 1 - msb);
+        return slice(lsb, m_buf.size() - 1 - msb);
     }
     VlQueue sliceBackBack(int32_t lsb, int32_t msb) const {
-        return slice(m_deque.size() - 1 - lsb, m_deque.size() - 1 - msb);
+        return slice(m_buf.size() - 1 - lsb, m_buf.size() - 1 - msb);
     }
 
     // For save/restore
-    const_iterator begin() const { return m_deque.begin(); }
-    const_iterator end() const { return m_deque.end(); }
+    const_iterator begin() const { return m_buf.begin(); }
+    const_iterator end() const { return m_buf.end(); }
 
     // Methods
-    void sort() { std::sort(m_deque.begin(), m_deque.end()); }
+    void sort() { std::sort(m_buf.begin(), m_buf.end()); }
     template <typename T_Func>
     void sort(T_Func with_func) {
         // with_func returns arbitrary type to use for the sort comparison
-        std::sort(m_deque.begin(), m_deque.end(), [=](const T_Value& a, const T_Value& b) {
+        std::sort(m_buf.begin(), m_buf.end(), [=](const T_Value& a, const T_Value& b) {
             // index number is meaningless with sort, as it changes
             return with_func(0, a) < with_func(0, b);
         });
     }
-    void rsort() { std::sort(m_deque.rbegin(), m_deque.rend()); }
+    void rsort() { std::sort(m_buf.rbegin(), m_buf.rend()); }
     template <typename T_Func>
     void rsort(T_Func with_func) {
         // with_func returns arbitrary type to use for the sort comparison
-        std::sort(m_deque.rbegin(), m_deque.rend(), [=](const T_Value& a, const T_Value& b) {
+        std::sort(m_buf.rbegin(), m_buf.rend(), [=](const T_Value& a, const T_Value& b) {
             // index number is meaningless with sort, as it changes
             return with_func(0, a) < with_func(0, b);
         });
     }
-    void reverse() { std::reverse(m_deque.begin(), m_deque.end()); }
-    void shuffle() { std::shuffle(m_deque.begin(), m_deque.end(), VlURNG{}); }
+    void reverse() { std::reverse(m_buf.begin(), m_buf.end()); }
+    void shuffle() { std::shuffle(m_buf.begin(), m_buf.end(), VlURNG{}); }
     VlQueue unique() const {
         VlQueue out;
         std::set<T_Value> saw;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             const auto it = saw.find(i);
             if (it == saw.end()) {
                 saw.insert(it, i);
@@ -706,8 +1025,8 @@ public:
     template <typename T_Func>
     VlQueue unique(T_Func with_func) const {
         VlQueue out;
-        std::set<decltype(with_func(0, m_deque[0]))> saw;
-        for (const auto& i : m_deque) {
+        std::set<decltype(with_func(0, m_buf[0]))> saw;
+        for (const auto& i : m_buf) {
             const auto i_mapped = with_func(0, i);
             const auto it = saw.find(i_mapped);
             if (it == saw.end()) {
@@ -721,7 +1040,7 @@ public:
         VlQueue<IData> out;
         IData index = 0;
         std::set<T_Value> saw;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             const auto it = saw.find(i);
             if (it == saw.end()) {
                 saw.insert(it, i);
@@ -735,8 +1054,8 @@ public:
     VlQueue<IData> unique_index(T_Func with_func) const {
         VlQueue<IData> out;
         IData index = 0;
-        std::set<decltype(with_func(0, m_deque[0]))> saw;
-        for (const auto& i : m_deque) {
+        std::set<decltype(with_func(0, m_buf[0]))> saw;
+        for (const auto& i : m_buf) {
             const auto i_mapped = with_func(index, i);
             auto it = saw.find(i_mapped);
             if (it == saw.end()) {
@@ -751,7 +1070,7 @@ public:
     VlQueue find(T_Func with_func) const {
         VlQueue out;
         IData index = 0;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             if (with_func(index, i)) out.push_back(i);
             ++index;
         }
@@ -761,7 +1080,7 @@ public:
     VlQueue<IData> find_index(T_Func with_func) const {
         VlQueue<IData> out;
         IData index = 0;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             if (with_func(index, i)) out.push_back(index);
             ++index;
         }
@@ -771,7 +1090,7 @@ public:
     VlQueue find_first(T_Func with_func) const {
         // Can't use std::find_if as need index number
         IData index = 0;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             if (with_func(index, i)) return VlQueue::consV(i);
             ++index;
         }
@@ -780,7 +1099,7 @@ public:
     template <typename T_Func>
     VlQueue<IData> find_first_index(T_Func with_func) const {
         IData index = 0;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             if (with_func(index, i)) return VlQueue<IData>::consV(index);
             ++index;
         }
@@ -788,8 +1107,8 @@ public:
     }
     template <typename T_Func>
     VlQueue find_last(T_Func with_func) const {
-        IData index = m_deque.size() - 1;
-        for (auto& item : vlstd::reverse_view(m_deque)) {
+        IData index = m_buf.size() - 1;
+        for (auto& item : vlstd::reverse_view(m_buf)) {
             if (with_func(index, item)) return VlQueue::consV(item);
             --index;
         }
@@ -797,8 +1116,8 @@ public:
     }
     template <typename T_Func>
     VlQueue<IData> find_last_index(T_Func with_func) const {
-        IData index = m_deque.size() - 1;
-        for (auto& item : vlstd::reverse_view(m_deque)) {
+        IData index = m_buf.size() - 1;
+        for (auto& item : vlstd::reverse_view(m_buf)) {
             if (with_func(index, item)) return VlQueue<IData>::consV(index);
             --index;
         }
@@ -807,28 +1126,28 @@ public:
 
     // Reduction operators
     VlQueue min() const {
-        if (m_deque.empty()) return VlQueue{};
-        const auto it = std::min_element(m_deque.cbegin(), m_deque.cend());
+        if (m_buf.empty()) return VlQueue{};
+        const auto it = std::min_element(m_buf.cbegin(), m_buf.cend());
         return VlQueue::consV(*it);
     }
     template <typename T_Func>
     VlQueue min(T_Func with_func) const {
-        if (m_deque.empty()) return VlQueue{};
-        const auto it = std::min_element(m_deque.cbegin(), m_deque.cend(),
+        if (m_buf.empty()) return VlQueue{};
+        const auto it = std::min_element(m_buf.cbegin(), m_buf.cend(),
                                          [&with_func](const IData& a, const IData& b) {
                                              return with_func(0, a) < with_func(0, b);
                                          });
         return VlQueue::consV(*it);
     }
     VlQueue max() const {
-        if (m_deque.empty()) return VlQueue{};
-        const auto it = std::max_element(m_deque.cbegin(), m_deque.cend());
+        if (m_buf.empty()) return VlQueue{};
+        const auto it = std::max_element(m_buf.cbegin(), m_buf.cend());
         return VlQueue::consV(*it);
     }
     template <typename T_Func>
     VlQueue max(T_Func with_func) const {
-        if (m_deque.empty()) return VlQueue{};
-        const auto it = std::max_element(m_deque.cbegin(), m_deque.cend(),
+        if (m_buf.empty()) return VlQueue{};
+        const auto it = std::max_element(m_buf.cbegin(), m_buf.cend(),
                                          [&with_func](const IData& a, const IData& b) {
                                              return with_func(0, a) < with_func(0, b);
                                          });
@@ -837,78 +1156,78 @@ public:
 
     T_Value r_sum() const {
         T_Value out(0);  // Type must have assignment operator
-        for (const auto& i : m_deque) out += i;
+        for (const auto& i : m_buf) out += i;
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_sum(T_Func with_func) const {
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(0);
         IData index = 0;
-        for (const auto& i : m_deque) out += with_func(index++, i);
+        for (const auto& i : m_buf) out += with_func(index++, i);
         return out;
     }
     T_Value r_product() const {
-        if (m_deque.empty()) return T_Value(0);  // The big three do it this way
+        if (m_buf.empty()) return T_Value(0);  // The big three do it this way
         T_Value out = T_Value(1);
-        for (const auto& i : m_deque) out *= i;
+        for (const auto& i : m_buf) out *= i;
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_product(T_Func with_func) const {
-        if (m_deque.empty()) return WithFuncReturnType<T_Func>(0);  // The big three do it this way
+        if (m_buf.empty()) return WithFuncReturnType<T_Func>(0);  // The big three do it this way
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(1);
         IData index = 0;
-        for (const auto& i : m_deque) out *= with_func(index++, i);
+        for (const auto& i : m_buf) out *= with_func(index++, i);
         return out;
     }
     T_Value r_and() const {
-        if (m_deque.empty()) return T_Value(0);  // The big three do it this way
+        if (m_buf.empty()) return T_Value(0);  // The big three do it this way
         T_Value out = ~T_Value(0);
-        for (const auto& i : m_deque) out &= i;
+        for (const auto& i : m_buf) out &= i;
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_and(T_Func with_func) const {
-        if (m_deque.empty()) return WithFuncReturnType<T_Func>(0);  // The big three do it this way
+        if (m_buf.empty()) return WithFuncReturnType<T_Func>(0);  // The big three do it this way
         IData index = 0;
         WithFuncReturnType<T_Func> out = ~WithFuncReturnType<T_Func>(0);
-        for (const auto& i : m_deque) out &= with_func(index++, i);
+        for (const auto& i : m_buf) out &= with_func(index++, i);
         return out;
     }
     T_Value r_or() const {
         T_Value out = T_Value(0);
-        for (const auto& i : m_deque) out |= i;
+        for (const auto& i : m_buf) out |= i;
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_or(T_Func with_func) const {
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(0);
         IData index = 0;
-        for (const auto& i : m_deque) out |= with_func(index++, i);
+        for (const auto& i : m_buf) out |= with_func(index++, i);
         return out;
     }
     T_Value r_xor() const {
 #ifdef VERILATOR_BIG3_NULLARY_ARITHMETICS_QUIRKS
-        if (m_deque.empty()) return T_Value(0);
+        if (m_buf.empty()) return T_Value(0);
 #endif
         T_Value out = T_Value(0);
-        for (const auto& i : m_deque) out ^= i;
+        for (const auto& i : m_buf) out ^= i;
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_xor(T_Func with_func) const {
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(0);
         IData index = 0;
-        for (const auto& i : m_deque) out ^= with_func(index++, i);
+        for (const auto& i : m_buf) out ^= with_func(index++, i);
         return out;
     }
 
     // Dumping. Verilog: str = $sformatf("%p", assoc)
     std::string to_string() const {
-        if (m_deque.empty()) return "'{}";  // No trailing space
+        if (m_buf.empty()) return "'{}";  // No trailing space
         std::string out = "'{";
         std::string comma;
-        for (const auto& i : m_deque) {
+        for (const auto& i : m_buf) {
             out += comma + VL_TO_STRING(i);
             comma = ", ";
         }
@@ -921,16 +1240,713 @@ std::string VL_TO_STRING(const VlQueue<T_Value, N_MaxSize>& obj) {
     return obj.to_string();
 }
 
+//===================================================================
+// Storage backends for VlAssocArray, selected with --assoc-storage
+// Each provides keyed lookup and iteration in key order. VlAssocMap is
+// ordered natively. VlAssocHash and VlAssocRadix are for integral keys, and
+// sort lazily when an ordered operation follows a change to the keys.
+// References to elements remain valid until the element is erased.
+// There are no multithreaded locks on these; the base variable must
+// be protected by other means
+
+// Balanced tree, the default
+template <typename T_Key, typename T_Value>
+class VlAssocMap final {
+    // TYPES
+    using Map = std::map<T_Key, T_Value>;
+
+public:
+    using const_iterator = typename Map::const_iterator;
+    using const_reverse_iterator = typename Map::const_reverse_iterator;
+
+private:
+    // MEMBERS
+    Map m_map;  // Elements
+
+public:
+    // METHODS
+    bool operator==(const VlAssocMap& rhs) const { return m_map == rhs.m_map; }
+    bool operator!=(const VlAssocMap& rhs) const { return m_map != rhs.m_map; }
+    size_t size() const { return m_map.size(); }
+    bool empty() const { return m_map.empty(); }
+    void clear() { m_map.clear(); }
+    void erase(const T_Key& key) { m_map.erase(key); }
+    // Return element, or nullptr if none
+    const T_Value* findp(const T_Key& key) const {
+        const auto it = m_map.find(key);
+        return it == m_map.end() ? nullptr : &it->second;
+    }
+    // Return element, inserting defaultValue if none
+    T_Value& at(const T_Key& key, const T_Value& defaultValue) {
+        const auto it = m_map.lower_bound(key);
+        if (it != m_map.end() && !(key < it->first)) return it->second;
+        return m_map.emplace_hint(it, key, defaultValue)->second;
+    }
+    // Return ordered iterator to element, or end() if none
+    const_iterator find(const T_Key& key) const { return m_map.find(key); }
+    const_iterator begin() const { return m_map.begin(); }
+    const_iterator end() const { return m_map.end(); }
+    const_iterator cbegin() const { return m_map.cbegin(); }
+    const_iterator cend() const { return m_map.cend(); }
+    const_reverse_iterator rbegin() const { return m_map.crbegin(); }
+    const_reverse_iterator rend() const { return m_map.crend(); }
+    const_reverse_iterator crbegin() const { return m_map.crbegin(); }
+    const_reverse_iterator crend() const { return m_map.crend(); }
+};
+
+// Open addressing table from an integral key to a pointer, for VlAssocHash
+// and VlAssocRadix. Linear probing, with backward shift on erase so no
+// tombstones are needed.
+template <typename T_Key, typename T_Ptr>
+class VlAssocIndex final {
+    // TYPES
+    struct Slot final {
+        T_Key m_key;
+        T_Ptr* m_ptrp;  // nullptr if slot is empty
+    };
+
+    // CONSTANTS
+    static constexpr size_t MIN_SLOTS = 16;
+
+    // MEMBERS
+    std::vector<Slot> m_slots;  // Power-of-two number of slots, or none
+    size_t m_size = 0;  // Number of used slots
+    unsigned m_shift = 64;  // 64 - log2(slots), for hashing to a slot
+
+public:
+    // CONSTRUCTORS
+    VlAssocIndex() = default;
+    ~VlAssocIndex() = default;
+    VlAssocIndex(const VlAssocIndex&) = delete;
+    VlAssocIndex(VlAssocIndex&& rhs) { swap(rhs); }
+    VlAssocIndex& operator=(const VlAssocIndex&) = delete;
+    VlAssocIndex& operator=(VlAssocIndex&& rhs) {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+private:
+    // METHODS
+    size_t slotIndex(T_Key key) const {
+        // Fibonacci hashing, which spreads sequential keys well
+        return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL)
+                                   >> m_shift);
+    }
+    size_t mask() const { return m_slots.size() - 1; }
+    VL_ATTR_NOINLINE void grow() {
+        std::vector<Slot> oldSlots{std::move(m_slots)};
+        const size_t slots = oldSlots.empty() ? MIN_SLOTS : oldSlots.size() * 2;
+        m_slots.assign(slots, Slot{T_Key{}, nullptr});
+        m_shift = 64;
+        for (size_t n = slots; n > 1; n >>= 1) --m_shift;
+        for (const Slot& slot : oldSlots) {
+            if (!slot.m_ptrp) continue;
+            size_t i = slotIndex(slot.m_key);
+            while (m_slots[i].m_ptrp) i = (i + 1) & mask();
+            m_slots[i] = slot;
+        }
+    }
+
+public:
+    size_t size() const { return m_size; }
+    void swap(VlAssocIndex& rhs) {
+        std::swap(m_slots, rhs.m_slots);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_shift, rhs.m_shift);
+    }
+    void clear() {
+        m_slots.clear();
+        m_size = 0;
+        m_shift = 64;
+    }
+    // Return pointer for key, or nullptr if none
+    T_Ptr* find(T_Key key) const {
+        if (VL_UNLIKELY(m_slots.empty())) return nullptr;
+        for (size_t i = slotIndex(key);; i = (i + 1) & mask()) {
+            const Slot& slot = m_slots[i];
+            if (!slot.m_ptrp) return nullptr;
+            if (slot.m_key == key) return slot.m_ptrp;
+        }
+    }
+    // Insert key, which must not be present
+    void insert(T_Key key, T_Ptr* ptrp) {
+        // Keep load factor at most 3/4
+        if (VL_UNLIKELY((m_size + 1) * 4 > m_slots.size() * 3)) grow();
+        size_t i = slotIndex(key);
+        while (m_slots[i].m_ptrp) i = (i + 1) & mask();
+        m_slots[i] = Slot{key, ptrp};
+        ++m_size;
+    }
+    // Erase key, which must be present
+    void erase(T_Key key) {
+        size_t i = slotIndex(key);
+        while (m_slots[i].m_key != key || !m_slots[i].m_ptrp) i = (i + 1) & mask();
+        // Shift back following slots that would no longer be reachable
+        for (size_t j = (i + 1) & mask(); m_slots[j].m_ptrp; j = (j + 1) & mask()) {
+            const size_t home = slotIndex(m_slots[j].m_key);
+            // Move if home is not cyclically within (i, j]
+            if (((j - home) & mask()) >= ((j - i) & mask())) {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }
+        m_slots[i].m_ptrp = nullptr;
+        --m_size;
+    }
+    // Call func(key, ptrp) for each entry, in no particular order
+    template <typename T_Func>
+    void foreach(T_Func func) const {
+        for (const Slot& slot : m_slots) {
+            if (slot.m_ptrp) func(slot.m_key, slot.m_ptrp);
+        }
+    }
+};
+
+// Open addressing hash table, for integral keys
+template <typename T_Key, typename T_Value>
+class VlAssocHash final {
+public:
+    // TYPES
+    using Entry = std::pair<T_Key, T_Value>;
+
+private:
+    struct EntryStorage final {
+        alignas(Entry) unsigned char m_bytes[sizeof(Entry)];
+    };
+
+    // CONSTANTS
+    static constexpr size_t CHUNK_ENTRIES = 64;  // Entries allocated at once
+    static constexpr size_t PENDING_MIN = 64;  // Least m_pendingMax
+
+    // MEMBERS
+    VlAssocIndex<T_Key, Entry> m_index;  // Key to entry
+    // Entries are allocated in chunks and never move, so references remain valid
+    std::vector<std::unique_ptr<EntryStorage[]>> m_chunks;  // Entry storage
+    std::vector<Entry*> m_freeps;  // Unused entries in m_chunks
+    // Keys are copied into m_sorted so finding them does not touch the entries.  Erasing
+    // leaves a tombstone, a nullptr entry keeping its key, so erases do not shift m_sorted;
+    // tombstones are dropped once they are half of m_sorted.  Keys not inserted in
+    // increasing order wait in m_pending, which is kept to about the square root of the
+    // size, until the next ordered access merges them in.
+    using Sorted = std::vector<std::pair<T_Key, Entry*>>;
+    mutable Sorted m_sorted;  // Keys and entries in key order, with tombstones
+    mutable Sorted m_pending;  // Keys and entries not yet in m_sorted, unordered
+    mutable size_t m_pendingMax = PENDING_MIN;  // Merge m_pending when larger than this
+    mutable size_t m_dead = 0;  // Tombstones in m_sorted, none of which are at the back
+    mutable size_t m_front = 0;  // No live entries in m_sorted before this index
+    mutable size_t m_hint = 0;  // Index in m_sorted of last find(), to iterate in O(1)
+
+public:
+    // Iterates in key order
+    class const_iterator final {
+        const Sorted* m_sortedp = nullptr;
+        size_t m_index = 0;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+
+        const_iterator() = default;
+        const_iterator(const Sorted* sortedp, size_t index)
+            : m_sortedp{sortedp}
+            , m_index{index} {}
+        reference operator*() const { return *(*m_sortedp)[m_index].second; }
+        pointer operator->() const { return (*m_sortedp)[m_index].second; }
+        const_iterator& operator++() {
+            do {
+                ++m_index;
+            } while (m_index < m_sortedp->size() && !(*m_sortedp)[m_index].second);
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const const_iterator it = *this;
+            ++*this;
+            return it;
+        }
+        const_iterator& operator--() {
+            do {
+                --m_index;
+            } while (!(*m_sortedp)[m_index].second);
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const const_iterator it = *this;
+            --*this;
+            return it;
+        }
+        bool operator==(const const_iterator& rhs) const { return m_index == rhs.m_index; }
+        bool operator!=(const const_iterator& rhs) const { return m_index != rhs.m_index; }
+    };
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // CONSTRUCTORS
+    VlAssocHash() = default;
+    ~VlAssocHash() { clear(); }
+    VlAssocHash(const VlAssocHash& rhs) { copyFrom(rhs); }
+    VlAssocHash(VlAssocHash&& rhs) { swap(rhs); }
+    VlAssocHash& operator=(const VlAssocHash& rhs) {
+        if (this != &rhs) {
+            clear();
+            copyFrom(rhs);
+        }
+        return *this;
+    }
+    VlAssocHash& operator=(VlAssocHash&& rhs) {
+        if (this != &rhs) {
+            clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+private:
+    // METHODS
+    void copyFrom(const VlAssocHash& rhs) {
+        // In key order, so each key appends to m_sorted
+        for (const Entry& entry : rhs) at(entry.first, entry.second);
+    }
+    void swap(VlAssocHash& rhs) {
+        m_index.swap(rhs.m_index);
+        std::swap(m_chunks, rhs.m_chunks);
+        std::swap(m_freeps, rhs.m_freeps);
+        std::swap(m_sorted, rhs.m_sorted);
+        std::swap(m_pending, rhs.m_pending);
+        std::swap(m_pendingMax, rhs.m_pendingMax);
+        std::swap(m_dead, rhs.m_dead);
+        std::swap(m_front, rhs.m_front);
+        std::swap(m_hint, rhs.m_hint);
+    }
+    VL_ATTR_NOINLINE void allocChunk() {
+        m_chunks.emplace_back(new EntryStorage[CHUNK_ENTRIES]);
+        EntryStorage* const storagep = m_chunks.back().get();
+        for (size_t i = CHUNK_ENTRIES; i > 0; --i) {
+            m_freeps.push_back(reinterpret_cast<Entry*>(&storagep[i - 1]));
+        }
+    }
+    static bool keyLess(const std::pair<T_Key, Entry*>& a, const T_Key& key) {
+        return a.first < key;
+    }
+    // Merge m_pending into m_sorted, dropping tombstones
+    VL_ATTR_NOINLINE void rebuild() const {
+        std::sort(m_pending.begin(), m_pending.end(),
+                  [](const std::pair<T_Key, Entry*>& a, const std::pair<T_Key, Entry*>& b) {
+                      return a.first < b.first;
+                  });
+        Sorted merged;
+        merged.reserve(m_index.size());
+        auto pendIt = m_pending.cbegin();
+        for (const auto& item : m_sorted) {
+            if (!item.second) continue;
+            while (pendIt != m_pending.cend() && pendIt->first < item.first) {
+                merged.push_back(*pendIt++);
+            }
+            merged.push_back(item);
+        }
+        merged.insert(merged.end(), pendIt, m_pending.cend());
+        m_sorted.swap(merged);
+        m_pending.clear();
+        m_pendingMax = PENDING_MIN;
+        while (m_pendingMax * m_pendingMax < m_sorted.size()) m_pendingMax *= 2;
+        m_dead = 0;
+        m_front = 0;
+        m_hint = 0;
+    }
+    void sort() const {
+        if (VL_UNLIKELY(!m_pending.empty())) rebuild();
+    }
+    // Return index in m_sorted of key, or m_sorted.size() if none, maybe a tombstone
+    size_t sortedIndex(const T_Key& key) const {
+        // Loops over first/next or last/prev find a neighbour of the last find
+        const size_t n = m_sorted.size();
+        for (size_t i = m_hint ? m_hint - 1 : 0; i < n && i <= m_hint + 1; ++i) {
+            if (m_sorted[i].first == key) {
+                m_hint = i;
+                return i;
+            }
+        }
+        const auto it = std::lower_bound(m_sorted.begin(), m_sorted.end(), key, keyLess);
+        if (it == m_sorted.end() || it->first != key) return n;
+        m_hint = it - m_sorted.begin();
+        return m_hint;
+    }
+    void insertSorted(const T_Key& key, Entry* entryp) {
+        if (VL_LIKELY(m_sorted.empty() || m_sorted.back().first < key)) {
+            m_sorted.emplace_back(key, entryp);
+            return;
+        }
+        // Reuse the tombstone of this key, or of the key before, as that keeps the order
+        const auto it = std::lower_bound(m_sorted.begin(), m_sorted.end(), key, keyLess);
+        size_t i = it - m_sorted.begin();
+        if (it->first != key || it->second) {
+            if (i == 0 || m_sorted[i - 1].second) {
+                m_pending.emplace_back(key, entryp);
+                if (VL_UNLIKELY(m_pending.size() > m_pendingMax)) rebuild();
+                return;
+            }
+            --i;
+        }
+        m_sorted[i] = {key, entryp};
+        --m_dead;
+        if (i < m_front) m_front = i;
+    }
+    void eraseSorted(const T_Key& key) {
+        const size_t i = sortedIndex(key);
+        if (i == m_sorted.size()) {
+            // Not merged yet
+            const auto it = std::find_if(
+                m_pending.begin(), m_pending.end(),
+                [&key](const std::pair<T_Key, Entry*>& item) { return item.first == key; });
+            *it = m_pending.back();
+            m_pending.pop_back();
+            return;
+        }
+        m_sorted[i].second = nullptr;
+        ++m_dead;
+        // Trailing tombstones are dropped, so last() needs no search
+        while (!m_sorted.empty() && !m_sorted.back().second) {
+            m_sorted.pop_back();
+            --m_dead;
+        }
+        if (VL_UNLIKELY(m_dead * 2 > m_sorted.size())) rebuild();
+    }
+
+public:
+    bool operator==(const VlAssocHash& rhs) const {
+        return size() == rhs.size() && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const VlAssocHash& rhs) const { return !(*this == rhs); }
+    size_t size() const { return m_index.size(); }
+    bool empty() const { return size() == 0; }
+    void clear() {
+        m_index.foreach([](T_Key, Entry* entryp) { entryp->~Entry(); });
+        m_index.clear();
+        m_chunks.clear();
+        m_freeps.clear();
+        m_sorted.clear();
+        m_pending.clear();
+        m_pendingMax = PENDING_MIN;
+        m_dead = 0;
+        m_front = 0;
+        m_hint = 0;
+    }
+    void erase(const T_Key& key) {
+        Entry* const entryp = m_index.find(key);
+        if (!entryp) return;
+        m_index.erase(key);
+        entryp->~Entry();
+        m_freeps.push_back(entryp);
+        eraseSorted(key);
+    }
+    // Return element, or nullptr if none
+    const T_Value* findp(const T_Key& key) const {
+        const Entry* const entryp = m_index.find(key);
+        return entryp ? &entryp->second : nullptr;
+    }
+    // Return element, inserting defaultValue if none
+    T_Value& at(const T_Key& key, const T_Value& defaultValue) {
+        if (Entry* const entryp = m_index.find(key)) return entryp->second;
+        if (VL_UNLIKELY(m_freeps.empty())) allocChunk();
+        Entry* const entryp = m_freeps.back();
+        new (entryp) Entry{key, defaultValue};
+        m_freeps.pop_back();
+        m_index.insert(key, entryp);
+        insertSorted(key, entryp);
+        return entryp->second;
+    }
+    // Return ordered iterator to element, or end() if none
+    const_iterator find(const T_Key& key) const {
+        sort();
+        const size_t i = sortedIndex(key);
+        if (i == m_sorted.size() || !m_sorted[i].second) return end();
+        return const_iterator{&m_sorted, i};
+    }
+    const_iterator begin() const {
+        sort();
+        // Skip leading tombstones, each only once between rebuilds
+        if (m_front > m_sorted.size()) m_front = m_sorted.size();
+        while (m_front < m_sorted.size() && !m_sorted[m_front].second) ++m_front;
+        return const_iterator{&m_sorted, m_front};
+    }
+    const_iterator end() const {
+        sort();
+        return const_iterator{&m_sorted, m_sorted.size()};
+    }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+};
+
+// Paged radix table, for integral keys that are address-like, e.g. sparse
+// memories. Consecutive keys share a page of entries, found through an
+// index of pages, and the most recently used page is cached.
+template <typename T_Key, typename T_Value>
+class VlAssocRadix final {
+public:
+    // TYPES
+    using Entry = std::pair<T_Key, T_Value>;
+
+private:
+    // CONSTANTS
+    static constexpr unsigned PAGE_BITS = 6;  // Entries per page are one bit each in m_used
+    static constexpr T_Key PAGE_MASK = (1U << PAGE_BITS) - 1;
+
+    struct Page final {
+        T_Key m_pageNum;  // Key >> PAGE_BITS of all entries
+        uint64_t m_used = 0;  // Bit per constructed entry
+        alignas(Entry) unsigned char m_bytes[sizeof(Entry) << PAGE_BITS];
+        explicit Page(T_Key pageNum)
+            : m_pageNum{pageNum} {}
+        Entry* entryp(unsigned offset) { return reinterpret_cast<Entry*>(m_bytes) + offset; }
+    };
+
+    static unsigned lowestBit(uint64_t v) {
+#ifdef __GNUC__
+        return __builtin_ctzll(v);
+#else
+        unsigned bit = 0;
+        while (!(v & 1)) {
+            v >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+    static unsigned highestBit(uint64_t v) {
+#ifdef __GNUC__
+        return 63 - __builtin_clzll(v);
+#else
+        unsigned bit = 0;
+        while (v >>= 1) ++bit;
+        return bit;
+#endif
+    }
+
+    // MEMBERS
+    VlAssocIndex<T_Key, Page> m_index;  // Page number to page
+    size_t m_size = 0;  // Number of elements
+    mutable Page* m_lastPagep = nullptr;  // Most recently used page
+    std::vector<Page*> m_pages;  // Pages in key order
+
+public:
+    // Iterates in key order
+    class const_iterator final {
+        const VlAssocRadix* m_radixp = nullptr;
+        size_t m_page = 0;  // Index in m_pages, or m_pages.size() at end
+        unsigned m_offset = 0;  // Entry within page
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+
+        const_iterator() = default;
+        const_iterator(const VlAssocRadix* radixp, size_t page, unsigned offset)
+            : m_radixp{radixp}
+            , m_page{page}
+            , m_offset{offset} {}
+        reference operator*() const { return *operator->(); }
+        pointer operator->() const { return m_radixp->m_pages[m_page]->entryp(m_offset); }
+        const_iterator& operator++() {
+            const std::vector<Page*>& pages = m_radixp->m_pages;
+            const uint64_t above
+                = m_offset == 63 ? 0 : pages[m_page]->m_used & (~0ULL << (m_offset + 1));
+            if (above) {
+                m_offset = lowestBit(above);
+            } else if (++m_page < pages.size()) {
+                m_offset = lowestBit(pages[m_page]->m_used);
+            } else {
+                m_offset = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const const_iterator it = *this;
+            ++*this;
+            return it;
+        }
+        const_iterator& operator--() {
+            const std::vector<Page*>& pages = m_radixp->m_pages;
+            const uint64_t below
+                = m_page < pages.size() ? pages[m_page]->m_used & ((1ULL << m_offset) - 1) : 0;
+            if (below) {
+                m_offset = highestBit(below);
+            } else {
+                --m_page;
+                m_offset = highestBit(pages[m_page]->m_used);
+            }
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const const_iterator it = *this;
+            --*this;
+            return it;
+        }
+        bool operator==(const const_iterator& rhs) const {
+            return m_page == rhs.m_page && m_offset == rhs.m_offset;
+        }
+        bool operator!=(const const_iterator& rhs) const { return !(*this == rhs); }
+    };
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // CONSTRUCTORS
+    VlAssocRadix() = default;
+    ~VlAssocRadix() { clear(); }
+    VlAssocRadix(const VlAssocRadix& rhs) { copyFrom(rhs); }
+    VlAssocRadix(VlAssocRadix&& rhs) { swap(rhs); }
+    VlAssocRadix& operator=(const VlAssocRadix& rhs) {
+        if (this != &rhs) {
+            clear();
+            copyFrom(rhs);
+        }
+        return *this;
+    }
+    VlAssocRadix& operator=(VlAssocRadix&& rhs) {
+        if (this != &rhs) {
+            clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+private:
+    // METHODS
+    void copyFrom(const VlAssocRadix& rhs) {
+        m_pages.reserve(rhs.m_pages.size());
+        for (Page* const rhsPagep : rhs.m_pages) {
+            Page* const pagep = new Page{rhsPagep->m_pageNum};
+            for (uint64_t used = rhsPagep->m_used; used; used &= used - 1) {
+                const unsigned offset = lowestBit(used);
+                new (pagep->entryp(offset)) Entry{*rhsPagep->entryp(offset)};
+            }
+            pagep->m_used = rhsPagep->m_used;
+            m_index.insert(pagep->m_pageNum, pagep);
+            m_pages.push_back(pagep);
+        }
+        m_size = rhs.m_size;
+    }
+    void swap(VlAssocRadix& rhs) {
+        m_index.swap(rhs.m_index);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_lastPagep, rhs.m_lastPagep);
+        std::swap(m_pages, rhs.m_pages);
+    }
+    static T_Key pageNum(T_Key key) { return static_cast<T_Key>(key >> PAGE_BITS); }
+    static unsigned pageOffset(T_Key key) { return static_cast<unsigned>(key & PAGE_MASK); }
+    Page* findPagep(T_Key key) const {
+        const T_Key num = pageNum(key);
+        if (VL_LIKELY(m_lastPagep && m_lastPagep->m_pageNum == num)) return m_lastPagep;
+        Page* const pagep = m_index.find(num);
+        if (pagep) m_lastPagep = pagep;
+        return pagep;
+    }
+    // Return index in m_pages of where page number num is or would go
+    size_t pageIndex(T_Key num) const {
+        return std::lower_bound(m_pages.begin(), m_pages.end(), num,
+                                [](const Page* pagep, T_Key n) { return pagep->m_pageNum < n; })
+               - m_pages.begin();
+    }
+
+public:
+    bool operator==(const VlAssocRadix& rhs) const {
+        return size() == rhs.size() && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const VlAssocRadix& rhs) const { return !(*this == rhs); }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    void clear() {
+        m_index.foreach([](T_Key, Page* pagep) {
+            for (uint64_t used = pagep->m_used; used; used &= used - 1) {
+                pagep->entryp(lowestBit(used))->~Entry();
+            }
+            delete pagep;
+        });
+        m_index.clear();
+        m_size = 0;
+        m_lastPagep = nullptr;
+        m_pages.clear();
+    }
+    void erase(const T_Key& key) {
+        Page* const pagep = findPagep(key);
+        const uint64_t bit = 1ULL << pageOffset(key);
+        if (!pagep || !(pagep->m_used & bit)) return;
+        pagep->entryp(pageOffset(key))->~Entry();
+        pagep->m_used &= ~bit;
+        --m_size;
+        if (!pagep->m_used) {
+            m_index.erase(pagep->m_pageNum);
+            m_pages.erase(m_pages.begin() + pageIndex(pagep->m_pageNum));
+            delete pagep;
+            m_lastPagep = nullptr;
+        }
+    }
+    // Return element, or nullptr if none
+    const T_Value* findp(const T_Key& key) const {
+        Page* const pagep = findPagep(key);
+        if (!pagep || !(pagep->m_used & (1ULL << pageOffset(key)))) return nullptr;
+        return &pagep->entryp(pageOffset(key))->second;
+    }
+    // Return element, inserting defaultValue if none
+    T_Value& at(const T_Key& key, const T_Value& defaultValue) {
+        Page* pagep = findPagep(key);
+        if (VL_UNLIKELY(!pagep)) {
+            pagep = new Page{pageNum(key)};
+            m_index.insert(pagep->m_pageNum, pagep);
+            m_lastPagep = pagep;
+            if (VL_LIKELY(m_pages.empty() || m_pages.back()->m_pageNum < pagep->m_pageNum)) {
+                m_pages.push_back(pagep);
+            } else {
+                m_pages.insert(m_pages.begin() + pageIndex(pagep->m_pageNum), pagep);
+            }
+        }
+        const unsigned offset = pageOffset(key);
+        Entry* const entryp = pagep->entryp(offset);
+        if (VL_UNLIKELY(!(pagep->m_used & (1ULL << offset)))) {
+            new (entryp) Entry{key, defaultValue};
+            pagep->m_used |= 1ULL << offset;
+            ++m_size;
+        }
+        return entryp->second;
+    }
+    // Return ordered iterator to element, or end() if none
+    const_iterator find(const T_Key& key) const {
+        const Page* const pagep = findPagep(key);
+        if (!pagep || !(pagep->m_used & (1ULL << pageOffset(key)))) return end();
+        return const_iterator{this, pageIndex(pagep->m_pageNum), pageOffset(key)};
+    }
+    const_iterator begin() const {
+        if (m_pages.empty()) return end();
+        return const_iterator{this, 0, lowestBit(m_pages[0]->m_used)};
+    }
+    const_iterator end() const { return const_iterator{this, m_pages.size(), 0}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+};
+
 //===================================================================
 // Verilog associative array container
 // There are no multithreaded locks on this; the base variable must
 // be protected by other means
+// T_Storage is the storage backend, see VlAssocMap
 //
-template <typename T_Key, typename T_Value>
+template <typename T_Key, typename T_Value,
+          template <typename, typename> class T_Storage = VlAssocMap>
 class VlAssocArray final {
 private:
     // TYPES
-    using Map = std::map<T_Key, T_Value>;
+    using Map = T_Storage<T_Key, T_Value>;
 
 public:
     using const_iterator = typename Map::const_iterator;
@@ -965,7 +1981,7 @@ public:
     void clear() { m_map.clear(); }
     void erase(const T_Key& index) { m_map.erase(index); }
     // Return 0/1 if element exists. Verilog: function int exists(input index)
-    int exists(const T_Key& index) const { return m_map.find(index) != m_map.end(); }
+    int exists(const T_Key& index) const { return m_map.findp(index) != nullptr; }
     // Return first element.  Verilog: function int first(ref index);
     int first(T_Key& indexr) const {
         const auto it = m_map.cbegin();
@@ -1001,22 +2017,11 @@ public:
     // Setting. Verilog: assoc[index] = v
     // Can't just overload operator[] or provide a "at" reference to set,
     // because we need to be able to insert only when the value is set
-    T_Value& at(const T_Key& index) {
-        const auto it = m_map.find(index);
-        if (it == m_map.end()) {
-            std::pair<typename Map::iterator, bool> pit = m_map.emplace(index, m_defaultValue);
-            return pit.first->second;
-        }
-        return it->second;
-    }
+    T_Value& at(const T_Key& index) { return m_map.at(index, m_defaultValue); }
     // Accessing. Verilog: v = assoc[index]
     const T_Value& at(const T_Key& index) const {
-        const auto it = m_map.find(index);
-        if (it == m_map.end()) {
-            return m_defaultValue;
-        } else {
-            return it->second;
-        }
+        const T_Value* const valuep = m_map.findp(index);
+        return valuep ? *valuep : m_defaultValue;
     }
     // Setting as a chained operation
     VlAssocArray& set(const T_Key& index, const T_Value& value) {
@@ -1117,7 +2122,7 @@ public:
             = std::find_if(m_map.cbegin(), m_map.cend(), [=](const std::pair<T_Key, T_Value>& i) {
                   return with_func(i.first, i.second);
               });
-        if (it == m_map.end()) return VlQueue<T_Value>{};
+        if (it == m_map.end()) return VlQueue<T_Key>{};
         return VlQueue<T_Key>::consV(it->first);
     }
     template <typename T_Func>
@@ -1133,7 +2138,7 @@ public:
         const auto it = std::find_if(
             m_map.crbegin(), m_map.crend(),
             [=](const std::pair<T_Key, T_Value>& i) { return with_func(i.first, i.second); });
-        if (it == m_map.rend()) return VlQueue<T_Value>{};
+        if (it == m_map.rend()) return VlQueue<T_Key>{};
         return VlQueue<T_Key>::consV(it->first);
     }
 
@@ -1251,14 +2256,15 @@ public:
     }
 };
 
-template <typename T_Key, typename T_Value>
-std::string VL_TO_STRING(const VlAssocArray<T_Key, T_Value>& obj) {
+template <typename T_Key, typename T_Value, template <typename, typename> class T_Storage>
+std::string VL_TO_STRING(const VlAssocArray<T_Key, T_Value, T_Storage>& obj) {
     return obj.to_string();
 }
 
-template <typename T_Key, typename T_Value>
+template <typename T_Key, typename T_Value, template <typename, typename> class T_Storage>
 void VL_READMEM_N(bool hex, int bits, const std::string& filename,
-                  VlAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
+                  VlAssocArray<T_Key, T_Value, T_Storage>& obj, QData start,
+                  QData end) VL_MT_SAFE {
     VlReadMem rmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!rmem.isOpen())) return;
     while (true) {
@@ -1272,9 +2278,10 @@ void VL_READMEM_N(bool hex, int bits, const std::string& filename,
     }
 }
 
-template <typename T_Key, typename T_Value>
+template <typename T_Key, typename T_Value, template <typename, typename> class T_Storage>
 void VL_WRITEMEM_N(bool hex, int bits, const std::string& filename,
-                   const VlAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
+                   const VlAssocArray<T_Key, T_Value, T_Storage>& obj, QData start,
+                   QData end) VL_MT_SAFE {
     VlWriteMem wmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!wmem.isOpen())) return;
     for (const auto& i : obj) {
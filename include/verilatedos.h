@@ -470,6 +470,7 @@ using ssize_t = uint32_t;  ///< signed size_t; returned from read()
 // Verilated function size macros
 
 #define VL_MULS_MAX_WORDS 128  ///< Max size in words of MULS operation
+#define VL_WIDE_TEMPLATE_WORDS 8  ///< Max size in words of width-specialized wide operations
 
 #ifndef VL_VALUE_STRING_MAX_WORDS
     #define VL_VALUE_STRING_MAX_WORDS 64  ///< Max size in words of String conversion operation
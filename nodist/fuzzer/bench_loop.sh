@@ -0,0 +1,32 @@
+#!/bin/bash
+######################################################################
+# DESCRIPTION: Fuzzer throughput measurement
+######################################################################
+
+# Compare Verilating one test case N times with a fresh process per run, as
+# the wrapper does, against the same N runs forked by --debug-fuzz-loop.
+# Usage: ./bench_loop.sh [test_case] [iterations]
+
+set -e
+
+INPUT=${1:-in1/$(ls in1 | head -1)}
+N=${2:-200}
+VERILATOR_BIN=../../bin/verilator_bin
+FLAGS="--cc --timing --quiet --Wno-lint --Wno-fatal"
+
+rm -rf obj_dir
+start=$(date +%s%N)
+for ((i = 0; i < N; i++)); do
+    "$VERILATOR_BIN" $FLAGS "$INPUT" >/dev/null 2>&1 || true
+    rm -rf obj_dir
+done
+exec_ns=$(($(date +%s%N) - start))
+
+start=$(date +%s%N)
+"$VERILATOR_BIN" --debug-fuzz-loop "$N" $FLAGS "$INPUT" >/dev/null 2>&1 || true
+loop_ns=$(($(date +%s%N) - start))
+rm -rf obj_dir
+
+echo "exec per run:              $((exec_ns / N / 1000)) us"
+echo "--debug-fuzz-loop per run: $((loop_ns / N / 1000)) us"
+echo "speedup:                   $(echo "scale=2; $exec_ns / $loop_ns" | bc)x"
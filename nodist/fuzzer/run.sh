@@ -5,4 +5,19 @@
 
 # Actually do the fuzzing.  Note that this will not terminate in any reasonable
 # amount of time.  However, it will give updates on its progress.
-afl-fuzz -i in1 -o out1 -x dictionary ./wrapper --cc --timing --quiet --Wno-lint --Wno-fatal @@
+# --debug-fuzz-cov adds which V3Const/V3DfgPeephole/V3Width rules fired to the
+# coverage map.
+FLAGS="--debug-fuzz-cov --cc --timing --quiet --Wno-lint --Wno-fatal"
+VERILATOR_BIN=../../bin/verilator_bin
+
+rm -rf obj_dir
+if nm "$VERILATOR_BIN" 2>/dev/null | grep -q __afl_persistent_loop; then
+    # Built with afl-clang-fast: --debug-fuzz-loop runs verilator_bin as a
+    # persistent-mode target, forking each test case from the already
+    # initialized process, and removing its output afterwards.
+    afl-fuzz -i in1 -o out1 -x dictionary "$VERILATOR_BIN" --debug-fuzz-loop 10000 $FLAGS @@
+else
+    # Otherwise --debug-fuzz-loop would Verilate every test case 10000 times,
+    # so exec one Verilation per test case through the wrapper.
+    afl-fuzz -i in1 -o out1 -x dictionary ./wrapper $FLAGS @@
+fi
@@ -0,0 +1,66 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Microbenchmark of wide (WData) multiply and divide
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// Prints nanoseconds per call of VL_MUL_W, VL_DIV_WWW and VL_MODDIV_WWW,
+// with a divisor of half the dividend's width. To compare against another
+// version, run run.sh a second time with VERILATOR_ROOT set to a configured
+// checkout of that version.
+//*************************************************************************
+
+#include "verilated.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+static volatile EData s_sink;  // Defeat dead code elimination
+
+template <typename T_Func>
+static double bench(int reps, T_Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < reps; ++n) func(n & 15);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / reps;
+}
+
+int main(int argc, char** argv) {
+    const int scale = argc > 1 ? std::atoi(argv[1]) : 1;
+    std::mt19937 rng{1};
+    // Cycle through several operands so the branch predictor can't learn one
+    static EData s_l[16][VL_MULS_MAX_WORDS];
+    static EData s_r[16][VL_MULS_MAX_WORDS];
+    static EData s_o[VL_MULS_MAX_WORDS];
+    std::printf("%5s %9s %9s %9s  (ns per call)\n", "bits", "MUL", "DIV", "MODDIV");
+    for (const int bits : {128, 256, 512, 1024, 2048, 4096}) {
+        const int words = VL_WORDS_I(bits);
+        for (int k = 0; k < 16; ++k) {
+            for (int i = 0; i < words; ++i) {
+                s_l[k][i] = rng();
+                s_r[k][i] = i < words / 2 ? rng() : 0;
+            }
+        }
+        const int reps = scale * (bits >= 2048 ? 20000 : 200000);
+        std::printf("%5d %9.0f %9.0f %9.0f\n", bits, bench(reps, [&](int k) {
+                        VL_MUL_W(words, s_o, s_l[k], s_r[k]);
+                        s_sink = s_o[0];
+                    }),
+                    bench(reps, [&](int k) {
+                        VL_DIV_WWW(bits, s_o, s_l[k], s_r[k]);
+                        s_sink = s_o[0];
+                    }),
+                    bench(reps, [&](int k) {
+                        VL_MODDIV_WWW(bits, s_o, s_l[k], s_r[k]);
+                        s_sink = s_o[0];
+                    }));
+    }
+    return 0;
+}
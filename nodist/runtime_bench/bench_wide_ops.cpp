@@ -0,0 +1,96 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Microbenchmark of wide (WData) runtime operators
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// Prints nanoseconds per call of the vectorized operators in verilated_funcs.h.
+// Build with run.sh, which compares VL_PORTABLE_ONLY against -mavx2 and
+// -mavx512f builds of the same source.
+//*************************************************************************
+
+#include "verilated.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static volatile IData s_sink;  // Defeat dead code elimination
+
+template <typename T_Func>
+static double bench(int reps, T_Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < reps; ++n) func(n);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / reps;
+}
+
+int main(int argc, char** argv) {
+    const int reps = argc > 1 ? std::atoi(argv[1]) : 2000000;
+    static EData s_l[VL_WORDS_I(4096)];
+    static EData s_r[VL_WORDS_I(4096)];
+    static EData s_o[VL_WORDS_I(4096)];
+    for (int i = 0; i < VL_WORDS_I(4096); ++i) {
+        s_l[i] = i * 2654435761U;
+        s_r[i] = i * 40503U;
+    }
+    std::printf("%5s %7s %7s %7s %7s %9s %7s %7s %7s %7s  (ns per call)\n", "bits", "AND",
+                "XOR", "NOT", "EQ", "COUNTONES", "REDXOR", "ADD", "SUB", "SHIFTR");
+    for (const int bits : {128, 256, 512, 1024, 2048, 4096}) {
+        const int words = VL_WORDS_I(bits);
+        // Each call feeds a result word back into an input, so calls cannot be hoisted
+        const int mask = words - 1;
+        std::printf(
+            "%5d %7.1f %7.1f %7.1f %7.1f %9.1f %7.1f %7.1f %7.1f %7.1f\n", bits,
+            bench(reps,
+                  [&](int n) {
+                      VL_AND_W(words, s_o, s_l, s_r);
+                      s_l[n & mask] ^= s_o[0];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      VL_XOR_W(words, s_o, s_l, s_r);
+                      s_l[n & mask] ^= s_o[0];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      VL_NOT_W(words, s_o, s_l);
+                      s_l[n & mask] ^= s_o[1];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      s_sink = VL_EQ_W(words, s_l, s_r);
+                      ++s_l[n & mask];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      s_sink = VL_COUNTONES_W(words, s_l);
+                      ++s_l[n & mask];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      s_sink = VL_REDXOR_W(words, s_l);
+                      ++s_l[n & mask];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      VL_ADD_W(words, s_o, s_l, s_r);
+                      s_l[n & mask] ^= s_o[0];
+                  }),
+            bench(reps,
+                  [&](int n) {
+                      VL_SUB_W(words, s_o, s_l, s_r);
+                      s_l[n & mask] ^= s_o[0];
+                  }),
+            bench(reps, [&](int n) {
+                VL_SHIFTR_WWI(bits, bits, 32, s_o, s_l, 37 + (n & 7));
+                s_l[n & mask] ^= s_o[0];
+            }));
+    }
+    return 0;
+}
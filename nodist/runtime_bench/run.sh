@@ -0,0 +1,54 @@
+#!/bin/bash
+######################################################################
+# DESCRIPTION: Verilator: Build and run the runtime microbenchmarks
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+######################################################################
+
+# Builds each benchmark against the runtime headers of a configured tree,
+# once per instruction set, and runs it.
+# Usage: ./run.sh [benchmark.cpp...]
+#   VERILATOR_ROOT  Tree whose include/ is benchmarked, default ../..
+#   CXX, CXXFLAGS   Compiler and base flags, default g++ -O2
+#   ISAS            Space separated flag sets, default portable, AVX2 and
+#                   AVX-512, skipping those the host cannot run
+
+set -e
+
+cd "$(dirname "$0")"
+ROOT=${VERILATOR_ROOT:-../..}
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2}
+BENCHES=${*:-bench_*.cpp}
+
+if [ -z "$ISAS" ]; then
+    ISAS="-DVL_PORTABLE_ONLY"
+    grep -q avx2 /proc/cpuinfo && ISAS="$ISAS|-mavx2 -mpopcnt -mbmi2"
+    grep -q avx512f /proc/cpuinfo && ISAS="$ISAS|-mavx512f -mavx512vl -mavx2 -mpopcnt -mbmi2"
+fi
+
+if [ ! -f "$ROOT/include/verilated_config.h" ]; then
+    echo "%Error: $ROOT/include/verilated_config.h not found, run configure first" >&2
+    exit 1
+fi
+
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+IFS='|'
+for bench in $BENCHES; do
+    for isa in $ISAS; do
+        echo "== $bench $isa"
+        IFS=' '
+        # shellcheck disable=SC2086
+        $CXX $CXXFLAGS $isa -std=c++14 -I"$ROOT/include" -I"$ROOT/include/vltstd" \
+            "$bench" "$ROOT/include/verilated.cpp" "$ROOT/include/verilated_threads.cpp" \
+            -pthread -o "$OUT/bench"
+        "$OUT/bench"
+        IFS='|'
+    done
+done
@@ -32,6 +32,7 @@ uint64_t VIsCached::s_cachedCntGbl = 1;
 
 uint64_t AstNode::s_editCntLast = 0;
 uint64_t AstNode::s_editCntGbl = 0;  // Hot cache line
+thread_local uint64_t* AstNode::t_editCntp = &AstNode::s_editCntGbl;
 
 // To allow for fast clearing of all user pointers, we keep a "timestamp"
 // along with each userp, and thus by bumping this count we can make it look
@@ -1334,7 +1335,7 @@ void AstNode::dumpTreeFile(const string& filename, bool doDump) {
     if (doDump) {
         {  // Write log & close
             UINFO(2, "Dumping " << filename << endl);
-            const std::unique_ptr<std::ofstream> logsp{V3File::new_ofstream(filename)};
+            const std::unique_ptr<std::ostream> logsp{V3File::new_ostream(filename)};
             if (logsp->fail()) v3fatal("Can't write " << filename);
             *logsp << "Verilator Tree Dump (format 0x3900) from <e" << std::dec << editCountLast();
             *logsp << "> to <e" << std::dec << editCountGbl() << ">\n";
@@ -1379,7 +1380,7 @@ void AstNode::dumpTreeDot(std::ostream& os) const {
 void AstNode::dumpTreeJsonFile(const string& filename, bool doDump) {
     if (!doDump) return;
     UINFO(2, "Dumping " << filename << endl);
-    const std::unique_ptr<std::ofstream> treejsonp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> treejsonp{V3File::new_ostream(filename)};
     if (treejsonp->fail()) v3fatal("Can't write " << filename);
     dumpTreeJson(*treejsonp);
     *treejsonp << '\n';
@@ -1388,7 +1389,7 @@ void AstNode::dumpTreeJsonFile(const string& filename, bool doDump) {
 void AstNode::dumpJsonMetaFileGdb(const char* filename) { dumpJsonMetaFile(filename); }
 void AstNode::dumpJsonMetaFile(const string& filename) {
     UINFO(2, "Dumping " << filename << endl);
-    const std::unique_ptr<std::ofstream> treejsonp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> treejsonp{V3File::new_ostream(filename)};
     if (treejsonp->fail()) v3fatalStatic("Can't write " << filename);
     *treejsonp << '{';
     FileLine::fileNameNumMapDumpJson(*treejsonp);
@@ -1402,7 +1403,7 @@ void AstNode::dumpJsonMetaFile(const string& filename) {
 void AstNode::dumpTreeDotFile(const string& filename, bool doDump) {
     if (doDump) {
         UINFO(2, "Dumping " << filename << endl);
-        const std::unique_ptr<std::ofstream> treedotp{V3File::new_ofstream(filename)};
+        const std::unique_ptr<std::ostream> treedotp{V3File::new_ostream(filename)};
         if (treedotp->fail()) v3fatal("Can't write " << filename);
         *treedotp << "digraph vTree{\n";
         *treedotp << "\tgraph\t[label=\"" << filename + ".dot"
@@ -26,6 +26,7 @@
 #include "V3FunctionTraits.h"
 #include "V3Global.h"
 #include "V3Number.h"
+#include "V3PoolAlloc.h"
 #include "V3StdFuture.h"
 
 #include "V3Ast__gen_forward_class_decls.h"  // From ./astgen
@@ -2033,6 +2034,7 @@ class AstNode VL_NOT_FINAL {
 #endif
     static uint64_t s_editCntGbl;  // Global edit counter
     static uint64_t s_editCntLast;  // Last committed value of global edit counter
+    static thread_local uint64_t* t_editCntp;  // Edit counter of the current thread
 
     AstNode* m_clonep = nullptr;  // Pointer to clone/source of node (only for *LAST* cloneTree())
     static int s_cloneCntGbl;  // Count of which userp is set
@@ -2165,6 +2167,9 @@ public:
 #ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
+#else
+    static void* operator new(size_t size) { return V3PoolAlloc::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3PoolAlloc::deallocate(objp, size); }
 #endif
 
     // CONSTANTS
@@ -2300,15 +2305,25 @@ public:
 #ifdef VL_DEBUG
     uint64_t editCount() const { return m_editCount; }
     void editCountInc() {
-        m_editCount = ++s_editCntGbl;  // Preincrement, so can "watch AstNode::s_editCntGbl=##"
-        VIsCached::clearCacheTree();  // Any edit clears all caching
+        m_editCount = ++*t_editCntp;  // Preincrement, so can "watch AstNode::s_editCntGbl=##"
+        // Any edit clears all caching; worker threads leave that to editCountMerge
+        if (t_editCntp == &s_editCntGbl) VIsCached::clearCacheTree();
     }
 #else
-    void editCountInc() { ++s_editCntGbl; }
+    void editCountInc() { ++*t_editCntp; }
 #endif
     static uint64_t editCountLast() VL_MT_SAFE { return s_editCntLast; }
     static uint64_t editCountGbl() VL_MT_SAFE { return s_editCntGbl; }
     static void editCountSetLast() { s_editCntLast = editCountGbl(); }
+    // Count this thread's edits in *cntp rather than the global counter (nullptr restores
+    // the global), for jobs editing disjoint subtrees on the thread pool. Once the jobs
+    // are done the enqueuing thread folds each count back in with editCountMerge.
+    static void editCountThread(uint64_t* cntp) { t_editCntp = cntp ? cntp : &s_editCntGbl; }
+    static void editCountMerge(uint64_t cnt) {
+        if (!cnt) return;
+        s_editCntGbl += cnt;
+        VIsCached::clearCacheTree();
+    }
 
     // ACCESSORS for specific types
     // Alas these can't be virtual or they break when passed a nullptr
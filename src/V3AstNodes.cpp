@@ -876,7 +876,15 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         const CTypeRecursed key = adtypep->keyDTypep()->cTypeRecurse(true, false);
         const CTypeRecursed val = adtypep->subDTypep()->cTypeRecurse(true, false);
-        info.m_type = "VlAssocArray<" + key.m_type + ", " + val.m_type + ">";
+        info.m_type = "VlAssocArray<" + key.m_type + ", " + val.m_type;
+        // Alternative storage is only for integral keys
+        const string storage = v3Global.opt.assocStorage();
+        if (storage != "map"
+            && (key.m_type == "CData" || key.m_type == "SData" || key.m_type == "IData"
+                || key.m_type == "QData")) {
+            info.m_type += storage == "hash" ? ", VlAssocHash" : ", VlAssocRadix";
+        }
+        info.m_type += ">";
     } else if (const auto* const adtypep = VN_CAST(dtypep, CDType)) {
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         info.m_type = adtypep->name();
@@ -23,6 +23,9 @@
 
 #include "V3Ast.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -31,9 +34,41 @@ template <typename T_Node, typename T_Data, int N_UserN>
 class AstUserAllocatorBase VL_NOT_FINAL {
     static_assert(1 <= N_UserN && N_UserN <= 4, "Wrong user pointer number");
     static_assert(std::is_base_of<AstNode, T_Node>::value, "T_Node must be an AstNode type");
+    static_assert(alignof(T_Data) <= alignof(std::max_align_t), "Over-aligned T_Data");
+
+    // User data is constructed in place in chunks that double in size up to a limit, so
+    // passes annotating millions of nodes make a handful of allocations, entries stay at
+    // stable addresses, and consecutively annotated nodes share cache lines.
+    static constexpr size_t MIN_CHUNK_BYTES = 4096;
+    static constexpr size_t MAX_CHUNK_BYTES = 4 * 1024 * 1024;
 
 private:
-    std::deque<T_Data> m_allocated;
+    struct Chunk final {
+        T_Data* m_datap;  // Storage for m_capacity elements
+        size_t m_capacity;  // Number of elements that fit
+        size_t m_used;  // Number of elements constructed
+    };
+    std::vector<Chunk> m_chunks;  // Storage chunks, last one being filled
+    size_t m_size = 0;  // Number of elements constructed in all chunks
+
+    template <typename... Args>
+    T_Data* allocate(Args&&... args) {
+        if (m_chunks.empty() || m_chunks.back().m_used == m_chunks.back().m_capacity) {
+            const size_t bytes = m_chunks.empty()
+                                     ? MIN_CHUNK_BYTES
+                                     : std::min(m_chunks.back().m_capacity * sizeof(T_Data) * 2,
+                                                MAX_CHUNK_BYTES);
+            const size_t capacity = std::max<size_t>(1, bytes / sizeof(T_Data));
+            void* const datap = ::operator new(capacity * sizeof(T_Data));
+            m_chunks.push_back(Chunk{static_cast<T_Data*>(datap), capacity, 0});
+        }
+        Chunk& chunk = m_chunks.back();
+        T_Data* const userp
+            = new (chunk.m_datap + chunk.m_used) T_Data(std::forward<Args>(args)...);
+        ++chunk.m_used;
+        ++m_size;
+        return userp;
+    }
 
     T_Data* getUserp(const T_Node* nodep) const {
         if VL_CONSTEXPR_CXX17 (N_UserN == 1) {
@@ -76,6 +111,8 @@ protected:
         }
     }
 
+    ~AstUserAllocatorBase() { clear(); }
+
     VL_UNCOPYABLE(AstUserAllocatorBase);
 
 public:
@@ -84,8 +121,7 @@ public:
     T_Data& operator()(T_Node* nodep, Args&&... args) {
         T_Data* userp = getUserp(nodep);
         if (!userp) {
-            m_allocated.emplace_back(std::forward<Args>(args)...);
-            userp = &m_allocated.back();
+            userp = allocate(std::forward<Args>(args)...);
             setUserp(nodep, userp);
         }
         return *userp;
@@ -101,7 +137,18 @@ public:
     // Get a pointer to the user data if exists, otherwise nullptr
     T_Data* tryGet(const T_Node* nodep) { return getUserp(nodep); }
 
-    void clear() { m_allocated.clear(); }
+    // Number of nodes with user data
+    size_t size() const { return m_size; }
+
+    // Destroy all user data, releasing the storage in bulk
+    void clear() {
+        for (const Chunk& chunk : m_chunks) {
+            for (size_t i = 0; i < chunk.m_used; ++i) chunk.m_datap[i].~T_Data();
+            ::operator delete(chunk.m_datap);
+        }
+        m_chunks.clear();
+        m_size = 0;
+    }
 };
 
 // User pointer allocator classes. T_Node is the type of node the allocator should be applied to
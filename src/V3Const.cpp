@@ -28,6 +28,7 @@
 #include "V3Const.h"
 
 #include "V3Ast.h"
+#include "V3FuzzCov.h"
 #include "V3Global.h"
 #include "V3Simulate.h"
 #include "V3Stats.h"
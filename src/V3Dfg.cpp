@@ -192,10 +192,9 @@ void DfgGraph::dumpDot(std::ostream& os, const string& label) const {
 void DfgGraph::dumpDotFile(const string& filename, const string& label) const {
     // This generates a file used by graphviz, https://www.graphviz.org
     // "hardcoded" parameters:
-    const std::unique_ptr<std::ofstream> os{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> os{V3File::new_ostream(filename)};
     if (os->fail()) v3fatal("Cannot write to file: " << filename);
     dumpDot(*os.get(), label);
-    os->close();
 }
 
 void DfgGraph::dumpDotFilePrefixed(const string& label) const {
@@ -243,7 +242,7 @@ static void dumpDotUpstreamConeFromVertex(std::ostream& os, const DfgVertex& vtx
 void DfgGraph::dumpDotUpstreamCone(const string& fileName, const DfgVertex& vtx,
                                    const string& name) const {
     // Open output file
-    const std::unique_ptr<std::ofstream> os{V3File::new_ofstream(fileName)};
+    const std::unique_ptr<std::ostream> os{V3File::new_ostream(fileName)};
     if (os->fail()) v3fatal("Cannot write to file: " << fileName);
 
     // Header
@@ -256,9 +255,6 @@ void DfgGraph::dumpDotUpstreamCone(const string& fileName, const DfgVertex& vtx,
 
     // Footer
     *os << "}\n";
-
-    // Done
-    os->close();
 }
 // LCOV_EXCL_STOP
 
@@ -277,7 +273,7 @@ void DfgGraph::dumpDotAllVarConesPrefixed(const string& label) const {
         // Open output file
         const string coneName{prefix + sinkp->varp()->name()};
         const string fileName{v3Global.debugFilename(coneName) + ".dot"};
-        const std::unique_ptr<std::ofstream> os{V3File::new_ofstream(fileName)};
+        const std::unique_ptr<std::ostream> os{V3File::new_ostream(fileName)};
         if (os->fail()) v3fatal("Cannot write to file: " << fileName);
 
         // Header
@@ -290,9 +286,6 @@ void DfgGraph::dumpDotAllVarConesPrefixed(const string& label) const {
 
         // Footer
         *os << "}\n";
-
-        // Done with this logic cone
-        os->close();
     });
 }
 
@@ -38,6 +38,7 @@
 #include "V3Global.h"
 #include "V3Hash.h"
 #include "V3List.h"
+#include "V3PoolAlloc.h"
 
 #include "V3Dfg__gen_forward_class_decls.h"  // From ./astgen
 
@@ -147,6 +148,8 @@ protected:
 
 public:
     virtual ~DfgVertex() VL_MT_DISABLED;
+    static void* operator new(size_t size) { return V3PoolAlloc::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3PoolAlloc::deallocate(objp, size); }
 
 private:
     V3ListLinks<DfgVertex>& links() { return m_links; }
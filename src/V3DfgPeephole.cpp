@@ -28,6 +28,7 @@
 #include "V3Dfg.h"
 #include "V3DfgCache.h"
 #include "V3DfgPasses.h"
+#include "V3FuzzCov.h"
 #include "V3Stats.h"
 
 #include <cctype>
@@ -154,6 +155,7 @@ class V3DfgPeephole final : public DfgVisitor {
         if (!m_ctx.m_enabled[id]) return false;
         UINFO(9, "Applying DFG pattern " << id.ascii() << endl);
         ++m_ctx.m_count[id];
+        V3FuzzCov::hit(V3FuzzCov::DFG_PEEPHOLE, id);
         return true;
     }
 
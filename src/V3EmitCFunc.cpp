@@ -47,6 +47,8 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     //   %nq      emitIQW on the [node]
     //   %nw      width in bits
     //   %nW      width in words
+    //   %nT      width in words, as a template argument if small enough to
+    //            have a specialized function, else as the first argument
     //   %ni      iterate
     //  %l*     lhsp - if appropriate, then second char as above
     //  %r*     rhsp - if appropriate, then second char as above
@@ -56,6 +58,7 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     //  ,       Commas suppressed if the previous field is suppressed
     string nextComma;
     bool needComma = false;
+    string pendingWords;  // %nT words to emit as first argument
 #define COMMA \
     do { \
         if (!nextComma.empty()) { \
@@ -133,6 +136,15 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
                         needComma = true;
                     }
                     break;
+                case 'T':
+                    if (lhsp->isWide()) {
+                        if (lhsp->widthWords() <= VL_WIDE_TEMPLATE_WORDS) {
+                            puts("<" + cvtToStr(lhsp->widthWords()) + ">");
+                        } else {
+                            pendingWords = cvtToStr(lhsp->widthWords());
+                        }
+                    }
+                    break;
                 case 'i':
                     COMMA;
                     UASSERT_OBJ(detailp, nodep, "emitOperator() references undef node");
@@ -151,6 +163,11 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
             COMMA;
             needComma = false;
             puts("(");
+            if (!pendingWords.empty()) {
+                puts(pendingWords);
+                pendingWords.clear();
+                needComma = true;
+            }
         } else {
             // Normal text
             if (std::isalnum(pos[0])) needComma = true;
@@ -162,20 +179,74 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     }
 }
 
+void EmitCFunc::displayEmitItems(AstNode* nodep) {
+    // Emit as a list of pre-parsed VlFmtItems, so runtime needs no format parsing
+    bool isStmt = false;
+    if (const AstDisplay* const dispp = VN_CAST(nodep, Display)) {
+        isStmt = true;
+        if (dispp->filep()) {
+            putns(nodep, "VL_FWRITEF_L(");
+            iterateConst(dispp->filep());
+            puts(",");
+        } else {
+            putns(nodep, "VL_WRITEF_L(");
+        }
+    } else if (const AstSFormat* const dispp = VN_CAST(nodep, SFormat)) {
+        isStmt = true;
+        puts("VL_SFORMAT_L(");
+        puts(cvtToStr(dispp->lhsp()->widthMin()));
+        putbs(",");
+        iterateConst(dispp->lhsp());
+        putbs(",");
+    } else if (VN_IS(nodep, SFormatF)) {
+        isStmt = false;
+        putns(nodep, "VL_SFORMATF_N_L(");
+    } else {
+        nodep->v3fatalSrc("Unknown displayEmit node type");
+    }
+    puts("{");
+    bool comma = false;
+    for (const EmitDispState::Item& item : m_emitDispState.m_items) {
+        if (comma) puts(",");
+        comma = true;
+        ofp()->indentInc();
+        ofp()->putbs("");
+        if (item.m_prefix.empty()) {
+            puts("VL_FMT_LIT(");
+            ofp()->putsNoTracking("\"" + V3OutFormatter::quoteNameControls(item.m_lit) + "\"");
+            puts(", " + cvtToStr(item.m_lit.size()) + ")");
+        } else {
+            puts(item.m_prefix);
+            if (item.m_argp) {
+                iterateConst(item.m_argp);
+                emitDatap(item.m_argp);
+            }
+            puts(item.m_suffix);
+        }
+        ofp()->indentDec();
+    }
+    puts("})");
+    if (isStmt) {
+        puts(";\n");
+    } else {
+        puts(" ");
+    }
+}
+
 void EmitCFunc::displayEmit(AstNode* nodep, bool isScan) {
     if (m_emitDispState.m_format == ""
         && VN_IS(nodep, Display)) {  // not fscanf etc, as they need to return value
         // NOP
+    } else if (!isScan) {
+        displayEmitItems(nodep);
+        m_emitDispState.clear();
     } else {
         // Format
-        bool isStmt = false;
         if (const AstFScanF* const dispp = VN_CAST(nodep, FScanF)) {
-            isStmt = false;
             putns(nodep, "VL_FSCANF_INX(");
             iterateConst(dispp->filep());
             puts(",");
         } else if (const AstSScanF* const dispp = VN_CAST(nodep, SScanF)) {
-            isStmt = false;
             checkMaxWords(dispp->fromp());
             putns(nodep, "VL_SSCANF_I");
             emitIQW(dispp->fromp());
@@ -184,25 +255,6 @@ void EmitCFunc::displayEmit(AstNode* nodep, bool isScan) {
             puts(",");
             iterateConst(dispp->fromp());
             puts(",");
-        } else if (const AstDisplay* const dispp = VN_CAST(nodep, Display)) {
-            isStmt = true;
-            if (dispp->filep()) {
-                putns(nodep, "VL_FWRITEF_NX(");
-                iterateConst(dispp->filep());
-                puts(",");
-            } else {
-                putns(nodep, "VL_WRITEF_NX(");
-            }
-        } else if (const AstSFormat* const dispp = VN_CAST(nodep, SFormat)) {
-            isStmt = true;
-            puts("VL_SFORMAT_NX(");
-            puts(cvtToStr(dispp->lhsp()->widthMin()));
-            putbs(",");
-            iterateConst(dispp->lhsp());
-            putbs(",");
-        } else if (VN_IS(nodep, SFormatF)) {
-            isStmt = false;
-            putns(nodep, "VL_SFORMATF_N_NX(");
         } else {
             nodep->v3fatalSrc("Unknown displayEmit node type");
         }
@@ -210,7 +262,6 @@ void EmitCFunc::displayEmit(AstNode* nodep, bool isScan) {
         ofp()->puts(",0");  // MSVC++ requires va_args to not be off reference
         // Arguments
         for (unsigned i = 0; i < m_emitDispState.m_argsp.size(); i++) {
-            const char fmt = m_emitDispState.m_argsChar[i];
             AstNode* const argp = m_emitDispState.m_argsp[i];
             const string func = m_emitDispState.m_argsFunc[i];
             if (func != "" || argp) {
@@ -220,27 +271,75 @@ void EmitCFunc::displayEmit(AstNode* nodep, bool isScan) {
                 if (func != "") {
                     puts(func);
                 } else if (argp) {
-                    const bool addrof = isScan || (fmt == '@');
-                    if (addrof) puts("&(");
+                    puts("&(");
                     iterateConst(argp);
-                    if (!addrof) emitDatap(argp);
-                    if (addrof) puts(")");
+                    puts(")");
                 }
                 ofp()->indentDec();
             }
         }
         // End
-        puts(")");
-        if (isStmt) {
-            puts(";\n");
-        } else {
-            puts(" ");
-        }
+        puts(") ");
         // Prep for next
         m_emitDispState.clear();
     }
 }
 
+string EmitCFunc::displayTimeunit(AstNode* dispp) {
+    // Timeunit argument for %t and %^
+    const AstSFormatF* fmtp = nullptr;
+    if (const AstDisplay* const nodep = VN_CAST(dispp, Display)) {
+        fmtp = nodep->fmtp();
+    } else if (const AstSFormat* const nodep = VN_CAST(dispp, SFormat)) {
+        fmtp = nodep->fmtp();
+    } else {
+        fmtp = VN_CAST(dispp, SFormatF);
+    }
+    UASSERT_OBJ(fmtp, dispp, "Use of %t must be under AstDisplay, AstSFormat, or AstSFormatF");
+    UASSERT_OBJ(!fmtp->timeunit().isNone(), fmtp, "timenunit must be set");
+    return cvtToStr((int)fmtp->timeunit().powerOfTen());
+}
+
+void EmitCFunc::displayItem(AstNode* dispp, AstNode* argp, const string& pfmt, char fmtLetter) {
+    // Push the VlFmtItem for one conversion; parse the printf-like
+    // format the same way _vl_vsformat would at runtime
+    int width = 0;
+    bool widthSet = false;
+    bool left = false;
+    const bool zero = pfmt.size() > 1 && pfmt[1] == '0';
+    for (size_t i = 1; i < pfmt.size() - 1; ++i) {
+        const char c = pfmt[i];
+        if (std::isdigit(c)) {
+            widthSet = true;
+            width = width * 10 + (c - '0');
+        } else if (c == '-') {
+            left = true;
+        }
+    }
+    string flags;
+    if (left) flags += "|VL_FMT_LEFT";
+    if (widthSet) flags += "|VL_FMT_WIDTH";
+    if (zero) flags += "|VL_FMT_ZERO";
+    flags = flags.empty() ? "0" : flags.substr(1);
+    const string fmtq = "'"s + fmtLetter + "'";
+    const string common = fmtq + ", " + flags + ", " + cvtToStr(width) + ", ";
+    const string timeunit
+        = (fmtLetter == 't' || fmtLetter == '^') ? ", " + displayTimeunit(dispp) : "";
+    if (argp->isString()) {
+        m_emitDispState.pushItem("VL_FMT_N(" + flags + ", " + cvtToStr(width) + ", ", argp, ")");
+    } else if (fmtLetter == 'e' || fmtLetter == 'f' || fmtLetter == 'g') {
+        m_emitDispState.pushItem(
+            "VL_FMT_R(" + common + "\"" + V3OutFormatter::quoteNameControls(pfmt) + "\", ", argp,
+            ")");
+    } else if (fmtLetter == '^') {
+        m_emitDispState.pushItem("VL_FMT_R(" + common + "nullptr, ", argp, timeunit + ")");
+    } else {
+        const string func = argp->isWide() ? "VL_FMT_W(" : "VL_FMT_Q(";
+        m_emitDispState.pushItem(func + common + cvtToStr(argp->widthMin()) + ", ", argp,
+                                 timeunit + ")");
+    }
+}
+
 void EmitCFunc::displayArg(AstNode* dispp, AstNode** elistp, bool isScan, const string& vfmt,
                            bool ignore, char fmtLetter) {
     // Print display argument, edits elistp
@@ -279,31 +378,21 @@ void EmitCFunc::displayArg(AstNode* dispp, AstNode** elistp, bool isScan, const
         pfmt = "%"s + vfmt + fmtLetter;
     }
     m_emitDispState.pushFormat(pfmt);
+    if (!ignore && !isScan) displayItem(dispp, argp, pfmt, fmtLetter);
     if (!ignore) {
         if (argp->dtypep()->basicp()
             && argp->dtypep()->basicp()->keyword() == VBasicDTypeKwd::STRING) {
             // string in SystemVerilog is std::string in C++ which is not POD
-            m_emitDispState.pushArg(' ', nullptr, "-1");
+            m_emitDispState.pushArg(nullptr, "-1");
         } else {
-            m_emitDispState.pushArg(' ', nullptr, cvtToStr(argp->widthMin()));
+            m_emitDispState.pushArg(nullptr, cvtToStr(argp->widthMin()));
         }
-        m_emitDispState.pushArg(fmtLetter, argp, "");
+        m_emitDispState.pushArg(argp, "");
         if (fmtLetter == 't' || fmtLetter == '^') {
-            const AstSFormatF* fmtp = nullptr;
-            if (const AstDisplay* const nodep = VN_CAST(dispp, Display)) {
-                fmtp = nodep->fmtp();
-            } else if (const AstSFormat* const nodep = VN_CAST(dispp, SFormat)) {
-                fmtp = nodep->fmtp();
-            } else {
-                fmtp = VN_CAST(dispp, SFormatF);
-            }
-            UASSERT_OBJ(fmtp, dispp,
-                        "Use of %t must be under AstDisplay, AstSFormat, or AstSFormatF");
-            UASSERT_OBJ(!fmtp->timeunit().isNone(), fmtp, "timenunit must be set");
-            m_emitDispState.pushArg(' ', nullptr, cvtToStr((int)fmtp->timeunit().powerOfTen()));
+            m_emitDispState.pushArg(nullptr, displayTimeunit(dispp));
         }
     } else {
-        m_emitDispState.pushArg(fmtLetter, nullptr, "");
+        m_emitDispState.pushArg(nullptr, "");
     }
 }
 
@@ -327,6 +416,7 @@ void EmitCFunc::displayNode(AstNode* nodep, AstScopeName* scopenamep, const stri
             vfmt = "";
         } else if (!inPct) {  // Normal text
             m_emitDispState.pushFormat(*pos);
+            m_emitDispState.pushLit(string(1, *pos));
         } else {  // Format character
             inPct = false;
             switch (std::tolower(pos[0])) {
@@ -348,6 +438,7 @@ void EmitCFunc::displayNode(AstNode* nodep, AstScopeName* scopenamep, const stri
                 break;
             case '%':
                 m_emitDispState.pushFormat("%%");  // We're printf'ing it, so need to quote the %
+                m_emitDispState.pushLit("%");
                 break;
             case '*':
                 vfmt += pos[0];
@@ -384,16 +475,20 @@ void EmitCFunc::displayNode(AstNode* nodep, AstScopeName* scopenamep, const stri
                 const string suffix = scopenamep->scopePrettySymName();
                 if (suffix == "") {
                     m_emitDispState.pushFormat("%S");
+                    m_emitDispState.pushItem("VL_FMT_S('S', vlSymsp->name())", nullptr, "");
                 } else {
                     m_emitDispState.pushFormat("%N");  // Add a . when needed
+                    m_emitDispState.pushItem("VL_FMT_S('N', vlSymsp->name())", nullptr, "");
                 }
-                m_emitDispState.pushArg(' ', nullptr, "vlSymsp->name()");
+                m_emitDispState.pushArg(nullptr, "vlSymsp->name()");
                 m_emitDispState.pushFormat(suffix);
+                m_emitDispState.pushLit(suffix);
                 break;
             }
             case 'l': {
                 // Better than not compiling
                 m_emitDispState.pushFormat("----");
+                m_emitDispState.pushLit("----");
                 break;
             }
             default:
@@ -606,6 +701,32 @@ void EmitCFunc::emitSetVarConstant(const string& assignString, AstConst* constp)
     puts(";\n");
 }
 
+static bool resetIsZero(const AstVar* varp, const AstBasicDType* basicp) {
+    return (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
+            || varp->isFuncLocal()  // Randomization too slow
+            || (basicp && basicp->isZeroInit())
+            || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
+            || (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0"));
+}
+
+bool EmitCFunc::lazyReset(const AstVar* varp) const {
+    // Model state is allocated zero-filled on demand, so large unpacked arrays whose
+    // reset value is zero need not be written (--lazy-array-size)
+    if (!v3Global.opt.lazyArraySize()) return false;
+    if (VN_IS(m_modp, Class) || varp->isFuncLocal() || varp->isClassMember()) return false;
+    if (varp->valuep() || (v3Global.opt.xInitialEdge() && varp->isUsedClock())) return false;
+    const AstNodeDType* dtypep = varp->dtypep()->skipRefp();
+    if (!VN_IS(dtypep, UnpackArrayDType)) return false;
+    uint64_t elements = 1;
+    while (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+        elements *= adtypep->elementsConst();
+        dtypep = adtypep->subDTypep()->skipRefp();
+    }
+    if (!dtypep->basicp() || !dtypep->isIntegralOrPacked()) return false;
+    return elements * dtypep->widthTotalBytes()
+           >= static_cast<uint64_t>(v3Global.opt.lazyArraySize());
+}
+
 void EmitCFunc::emitVarReset(AstVar* varp) {
     AstNodeDType* const dtypep = varp->dtypep()->skipRefp();
     const string varNameProtected = (VN_IS(m_modp, Class) || varp->isFuncLocal())
@@ -657,6 +778,13 @@ void EmitCFunc::emitVarReset(AstVar* varp) {
         } else {
             varp->v3fatalSrc("InitArray under non-arrayed var");
         }
+    } else if (lazyReset(varp)) {
+        if (!resetIsZero(varp, dtypep->basicp())) {
+            // Random reset values are only nonzero when requested at runtime
+            puts("if (VL_UNLIKELY(Verilated::threadContextp()->randReset())) {\n");
+            putns(varp, emitVarResetRecurse(varp, varNameProtected, dtypep, 0, ""));
+            puts("}\n");
+        }
     } else {
         putns(varp, emitVarResetRecurse(varp, varNameProtected, dtypep, 0, ""));
     }
@@ -732,12 +860,7 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, const string& varNameP
     } else if (basicp && basicp->isRandomGenerator()) {
         return "";
     } else if (basicp) {
-        const bool zeroit
-            = (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
-               || varp->isFuncLocal()  // Randomization too slow
-               || (basicp && basicp->isZeroInit())
-               || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
-               || (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0"));
+        const bool zeroit = resetIsZero(varp, basicp);
         const bool slow = !varp->isFuncLocal() && !varp->isClassMember();
         splitSizeInc(1);
         if (dtypep->isWide()) {  // Handle unpacked; not basicp->isWide
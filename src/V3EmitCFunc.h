@@ -124,23 +124,39 @@ class EmitCFunc VL_NOT_FINAL : public EmitCConstInit {
     // State associated with processing $display style string formatting
     struct EmitDispState final {
         string m_format;  // "%s" and text from user
-        std::vector<char> m_argsChar;  // Format of each argument to be printed
         std::vector<AstNode*> m_argsp;  // Each argument to be printed
         std::vector<string> m_argsFunc;  // Function before each argument to be printed
+        // Pre-parsed VlFmtItem form of the same format, used when not scanning
+        struct Item final {
+            string m_lit;  // Literal text, if m_prefix is empty
+            string m_prefix;  // Item constructor call up to the argument
+            AstNode* m_argp = nullptr;  // Argument, or nullptr if none
+            string m_suffix;  // Item constructor call after the argument
+        };
+        std::vector<Item> m_items;  // Each item to be printed
         EmitDispState() { clear(); }
         void clear() {
             m_format = "";
-            m_argsChar.clear();
             m_argsp.clear();
             m_argsFunc.clear();
+            m_items.clear();
         }
         void pushFormat(const string& fmt) { m_format += fmt; }
         void pushFormat(char fmt) { m_format += fmt; }
-        void pushArg(char fmtChar, AstNode* nodep, const string& func) {
-            m_argsChar.push_back(fmtChar);
+        void pushArg(AstNode* nodep, const string& func) {
             m_argsp.push_back(nodep);
             m_argsFunc.push_back(func);
         }
+        void pushLit(const string& lit) {
+            if (m_items.empty() || !m_items.back().m_prefix.empty()) m_items.emplace_back();
+            m_items.back().m_lit += lit;
+        }
+        void pushItem(const string& prefix, AstNode* argp, const string& suffix) {
+            m_items.emplace_back();
+            m_items.back().m_prefix = prefix;
+            m_items.back().m_argp = argp;
+            m_items.back().m_suffix = suffix;
+        }
     } m_emitDispState;
 
 protected:
@@ -181,6 +197,9 @@ public:
     void displayNode(AstNode* nodep, AstScopeName* scopenamep, const string& vformat,
                      AstNode* exprsp, bool isScan);
     void displayEmit(AstNode* nodep, bool isScan);
+    void displayEmitItems(AstNode* nodep);
+    string displayTimeunit(AstNode* dispp);
+    void displayItem(AstNode* dispp, AstNode* argp, const string& pfmt, char fmtLetter);
     void displayArg(AstNode* dispp, AstNode** elistp, bool isScan, const string& vfmt, bool ignore,
                     char fmtLetter);
 
@@ -210,6 +229,7 @@ public:
     void emitConstant(AstConst* nodep, AstVarRef* assigntop, const string& assignString);
     void emitConstantString(const AstConst* nodep);
     void emitSetVarConstant(const string& assignString, AstConst* constp);
+    bool lazyReset(const AstVar* varp) const;
     void emitVarReset(AstVar* varp);
     string emitVarResetRecurse(const AstVar* varp, const string& varNameProtected,
                                AstNodeDType* dtypep, int depth, const string& suffix);
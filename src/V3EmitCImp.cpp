@@ -485,6 +485,26 @@ class EmitCImp final : EmitCFunc {
             closeOutputFile();
         }
     }
+    // With '--output-stable-names', split at content defined points: before a function whose
+    // name hash selects it as a boundary, provided the file is not too small, or at the next
+    // function once the file is much too large. Inserting or removing a function then only
+    // moves the boundaries around it, rather than those of all subsequent files.
+    bool stableSplitNeeded(const AstCFunc* funcp) const {
+        const int limit = v3Global.opt.outputSplit();
+        if (!limit) return false;
+        if (m_splitSize >= 2 * limit) return true;
+        if (m_splitSize < limit / 4) return false;
+        // Each function is a boundary with probability proportional to its size, so on
+        // average a new file is started every 'limit' statements
+        const uint32_t size = funcp->nodeCount();
+        return V3Hash{funcp->name()}.value() % static_cast<uint32_t>(limit) < size;
+    }
+    // Name component of the file starting with the given function
+    string subFileName(const AstCFunc* funcp) const {
+        if (!v3Global.opt.outputStableNames()) return m_subFileName;
+        return m_subFileName + "__" + V3Hash{funcp->name()}.toString();
+    }
+
     void emitCFuncImp(const AstNodeModule* modp) {
         // Partition functions based on which module definitions they require, by building a
         // map from "AstNodeModules whose definitions are required" -> "functions that need
@@ -518,10 +538,19 @@ class EmitCImp final : EmitCFunc {
             V3Hash hash;
             for (const string& name : *m_requiredHeadersp) hash += name;
             m_subFileName = "DepSet_" + hash.toString();
+            // With stable names, emit in name order, so the placement of a function does
+            // not depend on the order the functions were created in
+            std::vector<AstCFunc*> funcps = pair.second;
+            if (v3Global.opt.outputStableNames()) {
+                std::stable_sort(funcps.begin(), funcps.end(),
+                                 [](const AstCFunc* ap, const AstCFunc* bp) {
+                                     return ap->name() < bp->name();
+                                 });
+            }
             // Open output file
-            openNextOutputFile(*m_requiredHeadersp, m_subFileName);
+            openNextOutputFile(*m_requiredHeadersp, subFileName(funcps.front()));
             // Emit functions in this dependency set
-            for (AstCFunc* const funcp : pair.second) {
+            for (AstCFunc* const funcp : funcps) {
                 VL_RESTORER(m_modp);
                 m_modp = EmitCParentModule::get(funcp);
                 iterateConst(funcp);
@@ -533,13 +562,13 @@ class EmitCImp final : EmitCFunc {
 
     // VISITORS
     void visit(AstCFunc* nodep) override {
-        if (splitNeeded()) {
+        if (v3Global.opt.outputStableNames() ? stableSplitNeeded(nodep) : splitNeeded()) {
             // Splitting file, so using parallel build.
             v3Global.useParallelBuild(true);
             // Close old file
             closeOutputFile();
             // Open a new file
-            openNextOutputFile(*m_requiredHeadersp, m_subFileName);
+            openNextOutputFile(*m_requiredHeadersp, subFileName(nodep));
         }
 
         EmitCFunc::visit(nodep);
@@ -52,22 +52,22 @@ class CMakeEmitter final {
     // cache_type should be empty for a normal variable
     // "BOOL", "FILEPATH", "PATH", "STRING" or "INTERNAL" for a CACHE variable
     // See https://cmake.org/cmake/help/latest/command/set.html
-    static void cmake_set_raw(std::ofstream& of, const string& name, const string& raw_value,
+    static void cmake_set_raw(std::ostream& of, const string& name, const string& raw_value,
                               const string& cache_type = "", const string& docstring = "") {
         of << "set(" << name << " " << raw_value;
         if (!cache_type.empty()) of << " CACHE " << cache_type << " \"" << docstring << '"';
         of << ")\n";
     }
 
-    static void cmake_set(std::ofstream& of, const string& name, const string& value,
+    static void cmake_set(std::ostream& of, const string& name, const string& value,
                           const string& cache_type = "", const string& docstring = "") {
         const string raw_value = '"' + value + '"';
         cmake_set_raw(of, name, raw_value, cache_type, docstring);
     }
 
     static void emitOverallCMake() {
-        const std::unique_ptr<std::ofstream> of{
-            V3File::new_ofstream(v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + ".cmake")};
+        const std::unique_ptr<std::ostream> of{
+            V3File::new_ostream(v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + ".cmake")};
         const string name = v3Global.opt.prefix();
 
         *of << "# Verilated -*- CMake -*-\n";
@@ -534,6 +534,11 @@ void EmitCSyms::emitSymHdr() {
     puts(symClassName() + "(VerilatedContext* contextp, const char* namep, " + topClassName()
          + "* modelp);\n");
     puts("~"s + symClassName() + "();\n");
+    if (v3Global.opt.lazyArraySize()) {
+        // Zero-filled on demand, so large arrays need no reset, see --lazy-array-size
+        puts("static void* operator new(size_t size) { return lazyAlloc(size); }\n");
+        puts("static void operator delete(void* ptr, size_t size) { lazyFree(ptr, size); }\n");
+    }
 
     for (const auto& i : m_usesVfinal) {
         puts("void " + symClassName() + "_" + cvtToStr(i.first) + "(");
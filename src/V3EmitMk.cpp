@@ -19,9 +19,14 @@
 #include "V3EmitMk.h"
 
 #include "V3EmitCBase.h"
+#include "V3File.h"
 #include "V3HierBlock.h"
 #include "V3Os.h"
 
+#include <fstream>
+#include <memory>
+#include <sstream>
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 // Groups adjacent files in a list, evenly distributing sum of scores
@@ -74,7 +79,7 @@ private:
     const uint64_t m_totalScore;  // Sum of file scores
     const std::string m_groupFilePrefix;  // Prefix for output group filenames
     std::vector<WorkList> m_workLists;  // Lists of small enough files
-    std::unique_ptr<std::ofstream> m_logp;  // Dump file
+    std::unique_ptr<std::ostream> m_logp;  // Dump file
     std::vector<WorkList*> m_concatenableListsByDescSize;  // Lists sorted by size, descending
 
     EmitGroup(std::vector<FilenameWithScore> inputFiles, uint64_t totalScore,
@@ -407,7 +412,7 @@ private:
         if (debug() >= 6 || dumpLevel() >= 6) {
             const string filename = v3Global.debugFilename("outputgroup") + ".txt";
             UINFO(5, "Dumping " << filename << endl);
-            m_logp = std::unique_ptr<std::ofstream>{V3File::new_ofstream(filename)};
+            m_logp = std::unique_ptr<std::ostream>{V3File::new_ostream(filename)};
             if (m_logp->fail()) v3fatal("Can't write " << filename);
         }
 
@@ -493,6 +498,80 @@ public:
         }
     }
 
+    // Read compile times in seconds from --output-groups-profile, by file name without
+    // directory or extension. The time of a file concatenated by a previous run is divided
+    // among the files it included, in proportion to their score.
+    static std::map<string, double>
+    readCompileProfile(const std::map<string, uint64_t>& scores) {
+        std::map<string, double> times;
+        const string filename = v3Global.opt.outputGroupsProfile();
+        const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(filename)};
+        if (ifp->fail()) {
+            UINFO(2, "--output-groups-profile: No profile read from " << filename << endl);
+            return times;
+        }
+        string line;
+        while (std::getline(*ifp, line)) {
+            std::istringstream is{line};
+            double secs = 0;
+            string name;
+            if (!(is >> secs >> name) || secs < 0) continue;
+            name = V3Os::filenameNonDirExt(name);
+            if (scores.count(name)) {
+                times[name] = secs;
+                continue;
+            }
+            if (!VString::startsWith(name, v3Global.opt.prefix() + "_vm_classes_")) continue;
+            // Concatenating file, which still lists what it included last time
+            std::vector<string> members;
+            uint64_t membersScore = 0;
+            const std::unique_ptr<std::ifstream> groupp{
+                V3File::new_ifstream_nodepend(v3Global.opt.makeDir() + "/" + name + ".cpp")};
+            string include;
+            while (std::getline(*groupp, include)) {
+                if (!VString::startsWith(include, "#include \"")) continue;
+                const string member = include.substr(10, include.rfind('"') - 10);
+                const auto it = scores.find(V3Os::filenameNonDirExt(member));
+                if (it == scores.end()) continue;
+                members.push_back(it->first);
+                membersScore += it->second;
+            }
+            for (const string& member : members) {
+                times[member] = secs * scores.at(member) / std::max<uint64_t>(1, membersScore);
+            }
+        }
+        return times;
+    }
+
+    // Replace file scores by compile times, scaled so the profiled files keep the same total
+    // score, and files without a recorded time keep their complexity score
+    static std::vector<FilenameWithScore>
+    applyCompileProfile(const std::vector<FilenameWithScore>& files,
+                        const std::map<string, double>& times, uint64_t& totalScore) {
+        uint64_t profiledScore = 0;
+        double profiledTime = 0;
+        for (const FilenameWithScore& file : files) {
+            const auto it = times.find(file.m_filename);
+            if (it == times.end()) continue;
+            V3Stats::addStatSum("Concatenation profiled files", 1);
+            profiledScore += file.m_score;
+            profiledTime += it->second;
+        }
+        if (profiledTime <= 0) return files;
+        const double scale = profiledScore / profiledTime;
+        std::vector<FilenameWithScore> result;
+        totalScore = 0;
+        for (const FilenameWithScore& file : files) {
+            const auto it = times.find(file.m_filename);
+            const uint64_t score = it == times.end()
+                                       ? file.m_score
+                                       : std::max<uint64_t>(1, it->second * scale + 0.5);
+            result.push_back({file.m_filename, score});
+            totalScore += score;
+        }
+        return result;
+    }
+
     void putMakeClassEntry(V3OutMkFile& of, const string& name) {
         of.puts("\t" + V3Os::filenameNonDirExt(name) + " \\\n");
         ++m_putClassCount;
@@ -520,6 +599,18 @@ public:
                 }
             }
 
+            if (!v3Global.opt.outputGroupsProfile().empty()) {
+                std::map<string, uint64_t> scores;
+                for (const std::vector<FilenameWithScore>* filesp : {&slowFiles, &fastFiles}) {
+                    for (const FilenameWithScore& file : *filesp) {
+                        scores.emplace(file.m_filename, file.m_score);
+                    }
+                }
+                const std::map<string, double> times = readCompileProfile(scores);
+                slowFiles = applyCompileProfile(slowFiles, times, slowTotalScore);
+                fastFiles = applyCompileProfile(fastFiles, times, fastTotalScore);
+            }
+
             vmClassesSlowList = EmitGroup::singleConcatenatedFilesList(
                 std::move(slowFiles), slowTotalScore, "vm_classes_Slow_");
             vmClassesFastList = EmitGroup::singleConcatenatedFilesList(
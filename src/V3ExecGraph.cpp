@@ -97,7 +97,7 @@ private:
     // Debugging
     void dumpDotFile(const V3Graph& graph, const string& filename) const {
         // This generates a file used by graphviz, https://www.graphviz.org
-        const std::unique_ptr<std::ofstream> logp{V3File::new_ofstream(filename)};
+        const std::unique_ptr<std::ostream> logp{V3File::new_ostream(filename)};
         if (logp->fail()) v3fatal("Can't write " << filename);
 
         // Header
@@ -159,7 +159,6 @@ private:
 
         // Trailer
         *logp << "}\n";
-        logp->close();
     }
 
     // Variant of dumpDotFilePrefixed without --dump option check
@@ -20,6 +20,7 @@
 
 #include "V3Os.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 #include <cerrno>
 #include <cstdarg>
@@ -135,17 +136,83 @@ public:
     }
     void writeDepend(const string& filename);
     std::vector<string> getAllDeps() const;
+    std::vector<string> getAllTargets() const;
     void writeTimes(const string& filename, const string& cmdlineIn);
     bool checkTimes(const string& filename, const string& cmdlineIn);
 };
 
 V3FileDependImp dependImp;  // Depend implementation class
 
+//######################################################################
+// V3FileMemoryImp: Generated files held in memory for --output-in-memory
+
+class V3FileMemoryImp final {
+    // MEMBERS
+    V3Mutex m_mutex;  // Protects members
+    std::map<const string, string> m_contents VL_GUARDED_BY(m_mutex);  // Filename -> contents
+
+public:
+    // METHODS
+    void write(const string& filename, string&& contents) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        m_contents[filename] = std::move(contents);
+    }
+    void append(const string& filename, const string& contents) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        m_contents[filename] += contents;
+    }
+    void report(std::ostream& os) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        size_t totalBytes = 0;
+        for (const auto& it : m_contents) {
+            os << "- Output: " << VHashSha256{it.second}.digestHex() << " " << std::setw(10)
+               << it.second.size() << " " << it.first << "\n";
+            totalBytes += it.second.size();
+        }
+        os << "- Output: " << m_contents.size() << " files, " << totalBytes
+           << " bytes kept in memory\n";
+    }
+};
+
+V3FileMemoryImp memoryImp;  // In-memory output implementation class
+
+class V3OutMemoryStream final : public std::ostringstream {
+    // Stream whose contents are handed to V3File::writeOutput when closed
+    const string m_filename;
+    const bool m_append;  // Add to any earlier in-memory contents
+
+public:
+    V3OutMemoryStream(const string& filename, bool append)
+        : m_filename{filename}
+        , m_append{append} {}
+    ~V3OutMemoryStream() override {
+        if (m_append) {
+            V3File::addTgtDepend(m_filename);
+            memoryImp.append(m_filename, str());
+        } else {
+            V3File::writeOutput(m_filename, str());
+        }
+    }
+};
+
+static bool fileContentsEqual(const string& filename, const string& contents) {
+    // Return true if the file exists and contains exactly 'contents'
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    struct stat st;
+    if (stat(filename.c_str(), &st) != 0) return false;
+    if (static_cast<size_t>(st.st_size) != contents.size()) return false;
+    std::ifstream is{filename, std::ios::binary};
+    if (!is) return false;
+    string existing(contents.size(), '\0');
+    if (!contents.empty() && !is.read(&existing[0], contents.size())) return false;
+    return existing == contents;
+}
+
 //######################################################################
 // V3FileDependImp
 
 void V3FileDependImp::writeDepend(const string& filename) {
-    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> ofp{V3File::new_ostream(filename)};
     if (ofp->fail()) v3fatal("Can't write " << filename);
 
     for (const DependFile& i : m_filenameList) {
@@ -177,8 +244,19 @@ std::vector<string> V3FileDependImp::getAllDeps() const {
     return r;
 }
 
+std::vector<string> V3FileDependImp::getAllTargets() const {
+    std::vector<string> r;
+    for (const auto& itr : m_filenameList) {
+        if (itr.target()) r.push_back(itr.filename());
+    }
+    return r;
+}
+
 void V3FileDependImp::writeTimes(const string& filename, const string& cmdlineIn) {
-    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+    // Always rewritten, even with --write-if-changed, as a timestamp for make rules
+    const std::unique_ptr<std::ostream> ofp{v3Global.opt.outputInMemory()
+                                                ? V3File::new_ostream(filename)
+                                                : V3File::new_ofstream(filename)};
     if (ofp->fail()) v3fatal("Can't write " << filename);
 
     const string cmdline = stripQuotes(cmdlineIn);
@@ -301,12 +379,43 @@ void V3File::addSrcDepend(const string& filename) VL_MT_SAFE { dependImp.addSrcD
 void V3File::addTgtDepend(const string& filename) VL_MT_SAFE { dependImp.addTgtDepend(filename); }
 void V3File::writeDepend(const string& filename) { dependImp.writeDepend(filename); }
 std::vector<string> V3File::getAllDeps() { return dependImp.getAllDeps(); }
+std::vector<string> V3File::getAllTargets() { return dependImp.getAllTargets(); }
 void V3File::writeTimes(const string& filename, const string& cmdlineIn) {
     dependImp.writeTimes(filename, cmdlineIn);
 }
 bool V3File::checkTimes(const string& filename, const string& cmdlineIn) {
     return dependImp.checkTimes(filename, cmdlineIn);
 }
+std::ostream* V3File::new_ostream(const string& filename, bool append) {
+    // Appending to a file on disk cannot tell if it changed, so only buffer the whole file
+    if (v3Global.opt.outputInMemory() || (v3Global.opt.writeIfChanged() && !append)) {
+        return new V3OutMemoryStream{filename, append};
+    }
+    return new_ofstream(filename, append);
+}
+void V3File::writeOutput(const string& filename, string&& contents) VL_MT_SAFE {
+    addTgtDepend(filename);
+    if (v3Global.opt.outputInMemory()) {
+        memoryImp.write(filename, std::move(contents));
+        return;
+    }
+    createMakeDirFor(filename);
+    if (fileContentsEqual(filename, contents)) {
+        // Keep the old file, and its timestamp, so a later make/ccache sees no change
+        UINFO(4, "--write-if-changed: Unchanged " << filename << endl);
+        return;
+    }
+    // Write a temporary and rename, so the target is never seen partially written
+    const string tmpFilename = filename + ".tmp";
+    FILE* const fp = fopen(tmpFilename.c_str(), "w");
+    if (!fp) v3fatal("Cannot write " << tmpFilename);
+    const bool ok = contents.empty() || fwrite(contents.data(), contents.size(), 1, fp) == 1;
+    if (fclose(fp) != 0 || !ok) v3fatal("Cannot write " << tmpFilename);
+    if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+        v3fatal("Cannot rename " << tmpFilename << " to " << filename);
+    }
+}
+void V3File::memoryReport(std::ostream& os) { memoryImp.report(os); }
 void V3File::createMakeDirFor(const string& filename) {
     if (filename != VL_DEV_NULL
         // If doesn't start with makeDir then some output file user requested
@@ -331,6 +440,7 @@ class VInFilterImp final {
     using StrList = VInFilter::StrList;
 
     std::map<const std::string, std::string> m_contentsMap;  // Cache of file contents
+    std::map<const std::string, std::string> m_prefetchMap;  // Read-ahead contents, used once
     bool m_readEof = false;  // Received EOF on read
 #ifdef INFILTER_PIPE
     pid_t m_pid = 0;  // fork() process id
@@ -572,7 +682,14 @@ protected:
             outl.push_back(it->second);
             return true;
         }
-        if (!readContents(filename, outl)) return false;
+        const auto pit = m_prefetchMap.find(filename);
+        if (pit != m_prefetchMap.end()) {
+            UINFO(2, "Using prefetched " << filename << endl);
+            outl.push_back(std::move(pit->second));
+            m_prefetchMap.erase(pit);
+        } else if (!readContents(filename, outl)) {
+            return false;
+        }
         if (listSize(outl) < INFILTER_CACHE_MAX) {
             // Cache small files (only to save space)
             // It's quite common to `include "timescale" thousands of times
@@ -581,6 +698,42 @@ protected:
         }
         return true;
     }
+    void prefetch(const std::vector<string>& filenames) {
+        // The filter process answers one request at a time, so only plain reads go wide
+        if (m_pid) return;
+        std::vector<string> contents(filenames.size());
+        std::vector<uint8_t> oks(filenames.size(), 0);
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < filenames.size(); ++i) {
+                threadScope.enqueue([&filenames, &contents, &oks, i]() {
+                    oks[i] = readFileAhead(filenames[i], contents[i]);
+                });
+            }
+        }
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            if (!oks[i] || m_contentsMap.count(filenames[i])) continue;
+            m_prefetchMap.emplace(filenames[i], std::move(contents[i]));
+        }
+    }
+    static bool readFileAhead(const string& filename, string& out) VL_MT_SAFE {
+        // As readContentsFile, but touches no filter state so may run on any thread
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        char buf[INFILTER_IPC_BUFSIZ];
+        while (true) {
+            const ssize_t got = read(fd, buf, INFILTER_IPC_BUFSIZ);
+            if (got > 0) {
+                out.append(buf, got);
+            } else if (got < 0 && errno == EINTR) {
+                continue;
+            } else {
+                break;
+            }
+        }
+        close(fd);
+        return true;
+    }
     static size_t listSize(const StrList& sl) {
         size_t result = 0;
         for (const string& i : sl) result += i.length();
@@ -609,6 +762,10 @@ bool VInFilter::readWholefile(const string& filename, VInFilter::StrList& outl)
     UASSERT(m_impp, "readWholefile on invalid filter");
     return m_impp->readWholefile(filename, outl);
 }
+void VInFilter::prefetch(const std::vector<string>& filenames) {
+    UASSERT(m_impp, "prefetch on invalid filter");
+    m_impp->prefetch(filenames);
+}
 
 //######################################################################
 // V3OutFormatter: A class for printing to a file, with automatic indentation of C++ code.
@@ -935,7 +1092,9 @@ void V3OutFormatter::printf(const char* fmt...) {
 V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{filename, lang}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
-    if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
+    if (v3Global.opt.outputInMemory() || v3Global.opt.writeIfChanged()) {
+        m_memoryp.reset(new string);
+    } else if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
         v3fatal("Cannot write " << filename);
     }
 }
@@ -943,6 +1102,7 @@ V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
 V3OutFile::~V3OutFile() {
     writeBlock();
 
+    if (m_memoryp) V3File::writeOutput(filename(), std::move(*m_memoryp));
     if (m_fp) fclose(m_fp);
     m_fp = nullptr;
 }
@@ -62,12 +62,21 @@ public:
         addTgtDepend(filename);
         return fopen(filename.c_str(), "w");
     }
+    // Output stream for a generated file, buffered under --output-in-memory or
+    // --write-if-changed and passed to writeOutput when deleted
+    static std::ostream* new_ostream(const string& filename, bool append = false);
+
+    // Commit buffered contents of a generated file; kept in memory under
+    // --output-in-memory, else written unless the file already has that content
+    static void writeOutput(const string& filename, string&& contents) VL_MT_SAFE;
+    static void memoryReport(std::ostream& os);
 
     // Dependencies
     static void addSrcDepend(const string& filename) VL_MT_SAFE;
     static void addTgtDepend(const string& filename) VL_MT_SAFE;
     static void writeDepend(const string& filename);
     static std::vector<string> getAllDeps();
+    static std::vector<string> getAllTargets();
     static void writeTimes(const string& filename, const string& cmdlineIn);
     static bool checkTimes(const string& filename, const string& cmdlineIn);
 
@@ -99,6 +108,9 @@ public:
     // METHODS
     // Read file contents and return it.  Return true on success.
     bool readWholefile(const string& filename, StrList& outl);
+    // Read the given files into memory ahead of use, in parallel across --verilate-jobs.
+    // Preprocessing and parsing remain serial, as `defines carry between files.
+    void prefetch(const std::vector<string>& filenames);
 };
 
 //============================================================================
@@ -207,6 +219,7 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
 
     // MEMBERS
     FILE* m_fp = nullptr;
+    std::unique_ptr<string> m_memoryp;  // Buffered contents for V3File::writeOutput, or nullptr
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
     std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_bufferp;  // Write buffer
@@ -229,7 +242,11 @@ public:
 private:
     void writeBlock() {
         if (VL_LIKELY(m_usedBytes > 0)) {
-            fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+            if (m_memoryp) {
+                m_memoryp->append(m_bufferp->data(), m_usedBytes);
+            } else {
+                fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+            }
             m_writtenBytes += m_usedBytes;
             m_usedBytes = 0;
         }
@@ -0,0 +1,139 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Transformation coverage feedback for fuzzers
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3FuzzCov's Transformations:
+//
+// The edge map is found, in order of preference:
+//   - AFL's shared memory segment, from the __AFL_SHM_ID environment variable.
+//     AFL_MAP_SIZE overrides the default 64KB map size.
+//     Under AFL_NO_FORKSRV=1 this gives feedback to an uninstrumented binary.
+//   - With VL_FUZZ_LIBFUZZER defined at build time, libFuzzer's extra
+//     counters section, which libFuzzer reads directly.
+//   - Otherwise a private map, which is only useful for debugging.
+//
+// Each hit is recorded as the AFL edge (previous ^ current) location, so
+// sequences of rule firings, not only individual rules, are distinguished.
+//
+//*************************************************************************
+
+#include "V3FuzzCov.h"
+
+#include "V3Ast.h"
+#include "V3DfgPeephole.h"
+#include "V3Error.h"
+#include "V3Global.h"
+#include "V3Os.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+// clang-format off
+#if !defined(_WIN32) && !defined(__MINGW32__)
+# include <sys/ipc.h>
+# include <sys/shm.h>
+# define VL_FUZZ_SHM  // Can attach System V shared memory
+#endif
+// clang-format on
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+constexpr uint32_t FUZZCOV_DEFAULT_MAP_SIZE = 1U << 16;  // AFL's MAP_SIZE
+
+#ifdef VL_FUZZ_LIBFUZZER
+__attribute__((section("__libfuzzer_extra_counters")))
+uint8_t v3FuzzCovLibFuzzerMap[FUZZCOV_DEFAULT_MAP_SIZE];
+#endif
+
+//######################################################################
+// V3FuzzCov
+
+uint8_t* V3FuzzCov::s_mapp = nullptr;
+uint32_t V3FuzzCov::s_mapMask = 0;
+uint32_t V3FuzzCov::s_prevLoc = 0;
+std::map<uint64_t, uint64_t>* V3FuzzCov::s_rulesp = nullptr;
+
+void V3FuzzCov::boot() {
+    uint32_t mapSize = FUZZCOV_DEFAULT_MAP_SIZE;
+    const string mapSizeEnv = V3Os::getenvStr("AFL_MAP_SIZE", "");
+    if (!mapSizeEnv.empty()) {
+        mapSize = static_cast<uint32_t>(std::strtoul(mapSizeEnv.c_str(), nullptr, 0));
+        // Round down to a power of two so the location can be masked
+        while (mapSize & (mapSize - 1)) mapSize &= mapSize - 1;
+        if (!mapSize) v3fatal("--debug-fuzz-cov: Bad AFL_MAP_SIZE: " << mapSizeEnv);
+    }
+#ifdef VL_FUZZ_SHM
+    const string shmId = V3Os::getenvStr("__AFL_SHM_ID", "");
+    if (!shmId.empty()) {
+        void* const mapp = shmat(std::atoi(shmId.c_str()), nullptr, 0);
+        if (VL_UNCOVERABLE(mapp == reinterpret_cast<void*>(-1))) {
+            v3fatal("--debug-fuzz-cov: Cannot attach __AFL_SHM_ID "  // LCOV_EXCL_LINE
+                    << shmId << ": " << std::strerror(errno));
+        }
+        s_mapp = static_cast<uint8_t*>(mapp);
+        s_mapMask = mapSize - 1;
+        UINFO(1, "--debug-fuzz-cov: Attached AFL map, size " << mapSize << endl);
+        return;
+    }
+#endif
+#ifdef VL_FUZZ_LIBFUZZER
+    s_mapp = v3FuzzCovLibFuzzerMap;
+    s_mapMask = FUZZCOV_DEFAULT_MAP_SIZE - 1;
+    UINFO(1, "--debug-fuzz-cov: Using libFuzzer extra counters\n");
+#else
+    // Intentionally leaked; lives for the whole run
+    s_mapp = new uint8_t[mapSize]{};
+    s_mapMask = mapSize - 1;
+    s_rulesp = new std::map<uint64_t, uint64_t>;
+    UINFO(1, "--debug-fuzz-cov: No fuzzer map, using private map\n");
+#endif
+}
+
+void V3FuzzCov::hitImp(Kind kind, uint32_t id) VL_MT_UNSAFE {
+    // Mix kind and id (murmur3 finalizer) so small enum ids spread over the map
+    uint32_t loc = (static_cast<uint32_t>(kind) << 24) ^ id;
+    loc ^= loc >> 16;
+    loc *= 0x85ebca6bU;
+    loc ^= loc >> 13;
+    loc *= 0xc2b2ae35U;
+    loc ^= loc >> 16;
+    ++s_mapp[(loc ^ s_prevLoc) & s_mapMask];
+    s_prevLoc = loc >> 1;
+    if (s_rulesp) ++(*s_rulesp)[(static_cast<uint64_t>(kind) << 32) | id];
+}
+
+void V3FuzzCov::report() {
+    if (!s_rulesp) return;
+    uint32_t edges = 0;
+    for (uint32_t i = 0; i <= s_mapMask; ++i) edges += s_mapp[i] != 0;
+    UINFO(1, "--debug-fuzz-cov: Private map has " << edges << " edges hit" << endl);
+    for (const auto& it : *s_rulesp) {
+        const uint32_t id = static_cast<uint32_t>(it.first);
+        std::ostringstream name;
+        switch (static_cast<Kind>(it.first >> 32)) {
+        case CONST_TREEOP: name << "CONST_TREEOP " << cvtToHex(id); break;
+        case DFG_PEEPHOLE: {
+            const VDfgPeepholePattern pattern{static_cast<VDfgPeepholePattern::en>(id)};
+            name << "DFG_PEEPHOLE " << pattern.ascii();
+            break;
+        }
+        case WIDTH_VISIT:
+            name << "WIDTH_VISIT " << VNType{static_cast<int>(id >> 2)}.ascii() << "/"
+                 << "-PFB"[id & 3];
+            break;
+        }
+        UINFO(1, "--debug-fuzz-cov: Rule " << name.str() << " hits " << it.second << endl);
+    }
+}
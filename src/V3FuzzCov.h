@@ -0,0 +1,64 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Transformation coverage feedback for fuzzers
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3FUZZCOV_H_
+#define VERILATOR_V3FUZZCOV_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <cstdint>
+#include <map>
+
+//######################################################################
+// V3FuzzCov -- Record which transformation rules fired into an AFL style
+// edge map, so a fuzzer gets semantic feedback without a compiler
+// instrumented build.  Disabled (a single pointer test) unless
+// --debug-fuzz-cov is given.
+
+class V3FuzzCov final {
+public:
+    // TYPES
+    enum Kind : uint32_t {
+        CONST_TREEOP = 1,  // V3Const TREEOP rule, id is hash of the rule text
+        DFG_PEEPHOLE = 2,  // V3DfgPeephole pattern, id is VDfgPeepholePattern
+        WIDTH_VISIT = 3,  // V3Width dispatch, id is VNType and stage
+    };
+
+private:
+    // STATE
+    static uint8_t* s_mapp;  // Edge map, nullptr when disabled
+    static uint32_t s_mapMask;  // Size of edge map minus one
+    static uint32_t s_prevLoc;  // Previous location, as in AFL's edge calculation
+    // Hits of each kind and id, kept only with the private map for debugging
+    static std::map<uint64_t, uint64_t>* s_rulesp;
+
+    static void hitImp(Kind kind, uint32_t id) VL_MT_UNSAFE;
+
+public:
+    // METHODS
+    // Attach to the fuzzer's edge map, if one is provided
+    static void boot();
+    static bool enabled() { return s_mapp; }
+    // Report the rules hit in the private map, under --debugi-V3FuzzCov 1
+    static void report();
+    // Record that rule 'id' of the given kind fired
+    static void hit(Kind kind, uint32_t id) VL_MT_UNSAFE {
+        if (VL_UNLIKELY(s_mapp)) hitImp(kind, id);
+    }
+};
+
+#endif  // Guard
@@ -23,6 +23,7 @@
 #include "V3File.h"
 #include "V3HierBlock.h"
 #include "V3LinkCells.h"
+#include "V3PassProfile.h"
 #include "V3Parse.h"
 #include "V3ParseSym.h"
 #include "V3Stats.h"
@@ -58,6 +59,22 @@ void V3Global::readFiles() {
 
     V3Parse parser{v3Global.rootp(), &filter, &parseSyms};
 
+    if (v3Global.opt.verilateJobs() > 1) {
+        // Load top and library files concurrently; they are then preprocessed in order below
+        std::vector<string> prefetchFiles;
+        FileLine* const cmdfl = new FileLine{FileLine::commandLineFilename()};
+        for (const string& filename : v3Global.opt.vFiles()) {
+            const string path = v3Global.opt.filePath(cmdfl, filename, "", "");
+            if (!path.empty()) prefetchFiles.push_back(path);
+        }
+        for (const string& filename : v3Global.opt.libraryFiles()) {
+            const string path = v3Global.opt.filePath(cmdfl, filename, "", "");
+            if (!path.empty()) prefetchFiles.push_back(path);
+        }
+        UINFO(2, "Prefetching " << prefetchFiles.size() << " source files" << endl);
+        filter.prefetch(prefetchFiles);
+    }
+
     // Parse the std waivers
     if (v3Global.opt.stdWaiver()) {
         parser.parseFile(
@@ -144,6 +161,7 @@ void V3Global::dumpCheckGlobalTree(const string& stagename, int newNumber, bool
         v3Global.rootp()->dumpTreeDotFile(treeFilename + ".dot", doDump);
     }
     if (v3Global.opt.stats()) V3Stats::statsStage(stagename);
+    if (VL_UNLIKELY(V3PassProfile::enabled())) V3PassProfile::stageEnd(stagename);
 
     if (doDump && v3Global.opt.debugEmitV()) V3EmitV::debugEmitV(treeFilename + ".v");
     if (v3Global.opt.debugCheck() || dumpTreeEitherLevel()) {
@@ -153,6 +171,18 @@ void V3Global::dumpCheckGlobalTree(const string& stagename, int newNumber, bool
         // set by other steps if it is called in the middle of other operations
         V3Broken::brokenAll(v3Global.rootp());
     }
+
+    v3Global.m_lastStage = stagename;
+    if (VL_UNLIKELY(stagename == v3Global.opt.debugExitAfter())) {
+        V3Error::abortIfErrors();
+        if (v3Global.opt.stats()) {
+            V3Stats::statsFinalAll(v3Global.rootp());
+            V3Stats::statsReport();
+        }
+        if (V3PassProfile::enabled()) V3PassProfile::write();
+        cout << "--debug-exit-after: Exiting after " << stagename << "\n";
+        std::exit(0);
+    }
 }
 
 void V3Global::idPtrMapDumpJson(std::ostream& os) {
@@ -108,6 +108,7 @@ class V3Global final {
         = VWidthMinUsage::LINT_WIDTH;  // What AstNode::widthMin() is used for
 
     std::atomic_int m_debugFileNumber{0};  // Number to append to debug files created
+    string m_lastStage;  // Name of last stage passed to dumpCheckGlobalTree
     bool m_assertDTypesResolved = false;  // Tree should have dtypep()'s
     bool m_assertScoped = false;  // Tree is scoped
     bool m_assignsEvents = false;  // Design uses assignments on SystemVerilog Events
@@ -156,6 +157,7 @@ public:
     VWidthMinUsage widthMinUsage() const VL_PURE { return m_widthMinUsage; }
     bool assertDTypesResolved() const { return m_assertDTypesResolved; }
     bool assertScoped() const { return m_assertScoped; }
+    const string& lastStage() const { return m_lastStage; }
 
     // METHODS
     void readFiles() VL_MT_DISABLED;
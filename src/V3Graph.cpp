@@ -283,7 +283,7 @@ void V3Graph::dumpDotFilePrefixedAlways(const string& nameComment, bool colorAsS
 void V3Graph::dumpDotFile(const string& filename, bool colorAsSubgraph) const {
     // This generates a file used by graphviz, https://www.graphviz.org
     // "hardcoded" parameters:
-    const std::unique_ptr<std::ofstream> logp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> logp{V3File::new_ostream(filename)};
     if (logp->fail()) v3fatal("Can't write " << filename);
 
     // Header
@@ -384,7 +384,6 @@ void V3Graph::dumpDotFile(const string& filename, bool colorAsSubgraph) const {
 
     // Trailer
     *logp << "}\n";
-    logp->close();
 
     cout << "dot -Tpdf -o ~/a.pdf " << filename << "\n";
 }
@@ -90,10 +90,12 @@
 
 #include "V3EmitV.h"
 #include "V3File.h"
+#include "V3InstrCount.h"
 #include "V3Os.h"
 #include "V3Stats.h"
 #include "V3String.h"
 
+#include <fstream>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -241,7 +243,7 @@ string V3HierBlock::vFileIfNecessary() const {
 }
 
 void V3HierBlock::writeCommandArgsFile(bool forCMake) const {
-    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(commandArgsFilename(forCMake))};
+    const std::unique_ptr<std::ostream> of{V3File::new_ostream(commandArgsFilename(forCMake))};
     *of << "--cc\n";
 
     if (!forCMake) {
@@ -271,7 +273,7 @@ void V3HierBlock::writeParametersFile() const {
 
     VHashSha256 hash{"type params"};
     const string moduleName = "Vhsh" + hash.digestSymbol();
-    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(typeParametersFilename())};
+    const std::unique_ptr<std::ostream> of{V3File::new_ostream(typeParametersFilename())};
     *of << "module " << moduleName << ";\n";
     for (AstParamTypeDType* const gparam : m_params.gTypeParams()) {
         AstTypedef* tdefp
@@ -357,6 +359,153 @@ public:
     }
 };
 
+//######################################################################
+// Mark modules as hierarchical blocks based on their size, for --hierarchical=auto
+
+class HierBlockAutoSelectVisitor final : public VNVisitorConst {
+    // TYPES
+    struct ModInfo final {
+        uint64_t m_ownSize = 0;  // Estimated instructions in this module itself
+        uint64_t m_instances = 0;  // Number of instances in the design, 0 if not yet known
+        uint64_t m_remaining = 0;  // Size including children that are not hierarchical blocks
+        bool m_sized = false;  // m_remaining is computed
+        bool m_timing = false;  // Contains timing controls, itself or below
+        bool m_timingChecked = false;  // m_timing includes children
+        bool m_crossRef = false;  // Contains or contains the target of a cross-module ref
+        bool m_ineligible = false;  // Cannot be a hierarchical block
+        std::vector<AstNodeModule*> m_cellModps;  // Module of each instance in this module
+        std::map<AstNodeModule*, uint64_t> m_parents;  // Instantiating modules -> instances
+    };
+
+    // STATE
+    std::map<const AstNodeModule*, ModInfo> m_info;  // Per module information
+    // Module declaring each variable or task, for modules only
+    std::unordered_map<const AstNode*, AstNodeModule*> m_declModp;
+    // Referencing module and the referenced variable or task, for possible cross-module refs
+    std::vector<std::pair<AstNodeModule*, const AstNode*>> m_refs;
+    AstNodeModule* m_modp = nullptr;  // Current module
+    const uint64_t m_targetSize = v3Global.opt.hierAutoSize();  // Target block size
+    size_t m_selected = 0;  // Number of blocks selected
+
+    // METHODS
+    void markCrossRefUpwards(AstNodeModule* modp) {
+        ModInfo& info = m_info[modp];
+        if (info.m_crossRef) return;  // Already marked, with its parents
+        info.m_crossRef = true;
+        info.m_ineligible = true;
+        for (const auto& pair : info.m_parents) markCrossRefUpwards(pair.first);
+    }
+    uint64_t instances(AstNodeModule* modp) {
+        ModInfo& info = m_info[modp];
+        if (!info.m_instances) {
+            if (info.m_parents.empty()) info.m_instances = 1;  // Top
+            for (const auto& pair : info.m_parents) {
+                info.m_instances += instances(pair.first) * pair.second;
+            }
+        }
+        return info.m_instances;
+    }
+    bool subtreeTiming(AstNodeModule* modp) {
+        ModInfo& info = m_info[modp];
+        if (info.m_timingChecked) return info.m_timing;
+        info.m_timingChecked = true;
+        for (AstNodeModule* const cellModp : info.m_cellModps) {
+            if (subtreeTiming(cellModp)) info.m_timing = true;
+        }
+        if (info.m_timing) info.m_ineligible = true;
+        return info.m_timing;
+    }
+    // Returns size of module, excluding hierarchical blocks, after selecting blocks below it
+    uint64_t select(AstNodeModule* modp, bool isTop) {
+        ModInfo& info = m_info[modp];
+        if (info.m_sized) return info.m_remaining;
+        info.m_sized = true;
+        info.m_remaining = info.m_ownSize;
+        for (AstNodeModule* const cellModp : info.m_cellModps) {
+            info.m_remaining += select(cellModp, false);
+        }
+        if (modp->hierBlock()) {  // Already marked by the user
+            info.m_remaining = 0;
+        } else if (!isTop && !info.m_ineligible && VN_IS(modp, Module)
+                   && info.m_remaining * instances(modp) >= m_targetSize
+                   && info.m_remaining >= m_targetSize / 8) {
+            UINFO(3, "Automatic hierarchical block " << modp->prettyNameQ() << " size "
+                                                     << info.m_remaining << " instances "
+                                                     << instances(modp) << endl);
+            modp->hierBlock(true);
+            info.m_remaining = 0;
+            ++m_selected;
+        }
+        return info.m_remaining;
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        m_info[nodep];  // Make sure it exists
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstCell* nodep) override {
+        if (AstNodeModule* const modp = nodep->modp()) {
+            m_info[m_modp].m_cellModps.push_back(modp);
+            ++m_info[modp].m_parents[m_modp];
+        }
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstVar* nodep) override {
+        if (VN_IS(m_modp, Module)) m_declModp.emplace(nodep, m_modp);
+        // Modports cannot cross the boundary. Parameterized modules are already specialized by
+        // V3Param here, but a block's parameters would need to be passed to its Verilation,
+        // so conservatively skip any module declaring a parameter, even if never overridden.
+        if (nodep->isIfaceRef() || nodep->isGParam()) m_info[m_modp].m_ineligible = true;
+    }
+    void visit(AstNodeFTask* nodep) override {
+        if (VN_IS(m_modp, Module)) m_declModp.emplace(nodep, m_modp);
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstVarXRef* nodep) override {
+        if (nodep->varp()) m_refs.emplace_back(m_modp, nodep->varp());
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeFTaskRef* nodep) override {
+        if (nodep->taskp()) m_refs.emplace_back(m_modp, nodep->taskp());
+        iterateChildrenConst(nodep);
+    }
+    // Widths are not resolved yet, so wide operations count as narrow ones. The sizes are
+    // only comparable to each other and to --hierarchical-auto-size, not exact.
+    void visit(AstNodeProcedure* nodep) override {
+        m_info[m_modp].m_ownSize += V3InstrCount::count(nodep, false);
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstAssignW* nodep) override {
+        m_info[m_modp].m_ownSize += V3InstrCount::count(nodep, false);
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstDelay*) override { m_info[m_modp].m_timing = true; }
+    void visit(AstEventControl*) override { m_info[m_modp].m_timing = true; }
+    void visit(AstWait*) override { m_info[m_modp].m_timing = true; }
+    void visit(AstWaitFork*) override { m_info[m_modp].m_timing = true; }
+    void visit(AstConstPool*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    explicit HierBlockAutoSelectVisitor(AstNetlist* netlistp) {
+        iterateChildrenConst(netlistp);
+        // Hierarchical references must not cross a block boundary
+        for (const auto& pair : m_refs) {
+            const auto it = m_declModp.find(pair.second);
+            if (it == m_declModp.end() || it->second == pair.first) continue;
+            markCrossRefUpwards(pair.first);
+            markCrossRefUpwards(it->second);
+        }
+        AstNodeModule* const topp = netlistp->topModulep();
+        subtreeTiming(topp);
+        select(topp, true);
+        V3Stats::addStat("HierBlock, Automatic hierarchical blocks", m_selected);
+    }
+};
+
 //######################################################################
 
 void V3HierBlockPlan::add(const AstNodeModule* modp, const V3HierBlockParams& params) {
@@ -395,6 +544,8 @@ void V3HierBlockPlan::createPlan(AstNetlist* nodep) {
         modp->hierBlock(false);
     }
 
+    if (v3Global.opt.hierarchicalAuto()) HierBlockAutoSelectVisitor{nodep};
+
     std::unique_ptr<V3HierBlockPlan> planp(new V3HierBlockPlan);
     { HierBlockUsageCollectVisitor{planp.get(), nodep}; }
 
@@ -450,8 +601,8 @@ void V3HierBlockPlan::writeCommandArgsFiles(bool forCMake) const {
         it->second->writeCommandArgsFile(forCMake);
     }
     // For the top module
-    const std::unique_ptr<std::ofstream> of{
-        V3File::new_ofstream(topCommandArgsFilename(forCMake))};
+    const std::unique_ptr<std::ostream> of{
+        V3File::new_ostream(topCommandArgsFilename(forCMake))};
     if (!forCMake) {
         // Load wrappers first not to be overwritten by the original HDL
         for (const_iterator it = begin(); it != end(); ++it) {
@@ -489,3 +640,114 @@ string V3HierBlockPlan::topCommandArgsFilename(bool forCMake) {
 void V3HierBlockPlan::writeParametersFiles() const {
     for (const auto& block : *this) { block.second->writeParametersFile(); }
 }
+
+//######################################################################
+// V3HierBlockCache
+//
+// An entry is named by a hash of the Verilator version and all arguments of the
+// --hierarchical-child run, and holds the digest of each source the run read, followed by
+// the contents of each file the run wrote under its -Mdir. The __verFiles.dat timestamps
+// are not cached, as they describe the files of the run that stored the entry; the caller
+// writes them again for the restored files.
+
+static const char* const HIER_CACHE_HEADER = "// Verilator hierarchical block cache v1";
+
+static string hierCacheFilename() {
+    VHashSha256 hash{V3Options::version()};
+    hash.insert(v3Global.opt.allArgsString());
+    return v3Global.opt.hierCache() + "/" + v3Global.opt.prefix() + "__" + hash.digestSymbol()
+           + ".vhc";
+}
+
+static bool hierCacheReadFile(const string& filename, string& contents) {
+    std::ifstream is{filename, std::ios::binary};
+    if (!is) return false;
+    std::ostringstream os;
+    os << is.rdbuf();
+    contents = os.str();
+    return true;
+}
+
+static bool hierCacheIsTimes(const string& filename) {
+    return filename == v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__verFiles.dat";
+}
+
+static string hierCacheDigest(const string& filename) {
+    string contents;
+    if (!hierCacheReadFile(filename, contents)) return "-";
+    return VHashSha256{contents}.digestHex();
+}
+
+bool V3HierBlockCache::restore() {
+    const string cacheFilename = hierCacheFilename();
+    // Read everything before writing any output, so a bad entry is just a miss
+    std::ifstream is{cacheFilename, std::ios::binary};
+    if (!is) return false;
+    string line;
+    if (!std::getline(is, line) || line != HIER_CACHE_HEADER) return false;
+    std::vector<string> sources;
+    std::vector<std::pair<string, string>> outputs;
+    while (std::getline(is, line)) {
+        if (line.size() < 2 || line[1] != ' ') return false;
+        if (line[0] == 'S') {  // Source: "S <digest> <filename>"
+            const size_t pos = line.find(' ', 2);
+            if (pos == string::npos) return false;
+            const string filename = line.substr(pos + 1);
+            if (hierCacheDigest(filename) != line.substr(2, pos - 2)) {
+                UINFO(2, "--hierarchical-cache: Stale due to " << filename << endl);
+                return false;
+            }
+            sources.push_back(filename);
+        } else if (line[0] == 'T') {  // Target: "T <size> <filename>" then the contents
+            const size_t pos = line.find(' ', 2);
+            if (pos == string::npos) return false;
+            string contents(std::strtoul(line.c_str() + 2, nullptr, 10), '\0');
+            if (!contents.empty() && !is.read(&contents[0], contents.size())) return false;
+            outputs.emplace_back(line.substr(pos + 1), std::move(contents));
+        } else {
+            return false;
+        }
+    }
+    UINFO(1, "--hierarchical-cache: Reusing " << cacheFilename << endl);
+    for (const string& filename : sources) V3File::addSrcDepend(filename);
+    for (auto& pair : outputs) {
+        V3File::writeOutput(v3Global.opt.makeDir() + "/" + pair.first, std::move(pair.second));
+    }
+    return true;
+}
+
+void V3HierBlockCache::store() {
+    // Messages would not be repeated when reusing the outputs, so don't cache
+    if (V3Error::errorCount() || V3Error::warnCount()) return;
+    if (v3Global.opt.outputInMemory()) return;
+    const string cacheFilename = hierCacheFilename();
+    const string tmpFilename = cacheFilename + ".tmp";
+    const string makeDir = v3Global.opt.makeDir() + "/";
+    // Best effort; if the cache can't be written the next run just Verilates again
+    V3Os::createDir(v3Global.opt.hierCache());
+    {
+        std::ofstream os{tmpFilename, std::ios::binary};
+        if (!os) return;
+        os << HIER_CACHE_HEADER << '\n';
+        for (const string& filename : V3File::getAllDeps()) {
+            os << "S " << hierCacheDigest(filename) << ' ' << filename << '\n';
+        }
+        for (const string& filename : V3File::getAllTargets()) {
+            if (hierCacheIsTimes(filename)) continue;
+            string contents;
+            if (!VString::startsWith(filename, makeDir)
+                || !hierCacheReadFile(filename, contents)) {
+                UINFO(2, "--hierarchical-cache: Not caching, cannot save " << filename << endl);
+                os.close();
+                std::remove(tmpFilename.c_str());
+                return;
+            }
+            os << "T " << contents.size() << ' ' << filename.substr(makeDir.size()) << '\n';
+            os << contents;
+        }
+        if (!os) return;
+    }
+    if (std::rename(tmpFilename.c_str(), cacheFilename.c_str()) == 0) {
+        UINFO(1, "--hierarchical-cache: Wrote " << cacheFilename << endl);
+    }
+}
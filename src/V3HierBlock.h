@@ -152,4 +152,17 @@ public:
     static void createPlan(AstNetlist* nodep) VL_MT_DISABLED;
 };
 
+//######################################################################
+
+// Cache of the outputs of hierarchical block Verilations, for --hierarchical-cache
+class V3HierBlockCache final {
+public:
+    // Write the outputs of this --hierarchical-child run from the cache if there is an entry
+    // for the same arguments and unchanged sources. Returns true if written, with the sources
+    // and outputs recorded as dependencies, but without writing __verFiles.dat.
+    static bool restore() VL_MT_DISABLED;
+    // Add the outputs of this --hierarchical-child run to the cache
+    static void store() VL_MT_DISABLED;
+};
+
 #endif  // guard
@@ -170,7 +170,7 @@ public:
     void dumpSelf(const string& nameComment = "linkdot", bool force = false) {
         if (dumpLevel() >= 6 || force) {
             const string filename = v3Global.debugFilename(nameComment) + ".txt";
-            const std::unique_ptr<std::ofstream> logp{V3File::new_ofstream(filename)};
+            const std::unique_ptr<std::ostream> logp{V3File::new_ostream(filename)};
             if (logp->fail()) v3fatal("Can't write " << filename);
             std::ostream& os = *logp;
             // TODO the symbol table has node pointers which may be
@@ -413,14 +413,16 @@ string V3Options::allArgsString() const VL_MT_SAFE {
     return result;
 }
 
-// Delete some options for Verilation of the hierarchical blocks.
-string V3Options::allArgsStringForHierBlock(bool forTop) const {
+// Return arguments, without the options stripOptionsForChildRun deletes, nor those extraStripp
+// deletes if not nullptr, which uses the same return codes.
+string V3Options::argsStringStripped(bool allArgs, bool forTop,
+                                     int (*extraStripp)(const string& opt)) const {
     std::set<string> vFiles;
     for (const auto& vFile : m_vFiles) vFiles.insert(vFile);
     string out;
     bool stripArg = false;
     bool stripArgIfNum = false;
-    for (const string& arg : m_impp->m_lineArgs) {
+    for (const string& arg : allArgs ? m_impp->m_allArgs : m_impp->m_lineArgs) {
         if (stripArg) {
             stripArg = false;
             continue;
@@ -437,7 +439,8 @@ string V3Options::allArgsStringForHierBlock(bool forTop) const {
         }
         if (skip > 0) {  // arg is an option
             const string opt = arg.substr(skip);  // Remove '-' in the beginning
-            const int numStrip = stripOptionsForChildRun(opt, forTop);
+            int numStrip = stripOptionsForChildRun(opt, forTop);
+            if (!numStrip && extraStripp) numStrip = extraStripp(opt);
             if (numStrip) {
                 UASSERT(0 <= numStrip && numStrip <= 3, "should be one of 0, 1, 2, 3");
                 if (numStrip == 2) stripArg = true;
@@ -458,6 +461,18 @@ string V3Options::allArgsStringForHierBlock(bool forTop) const {
     return out;
 }
 
+// Delete some options for Verilation of the hierarchical blocks.
+string V3Options::allArgsStringForHierBlock(bool forTop) const {
+    return argsStringStripped(false, forTop, nullptr);
+}
+
+string V3Options::allArgsStringForPreproc() const {
+    // Like allArgsStringForHierBlock, but from all arguments including those read from -f
+    // files, and also removing the options that differ between the Verilation of each
+    // hierarchical block. These only select what to elaborate and where to write it.
+    return argsStringStripped(true, false, stripOptionsForPreproc);
+}
+
 void V3Options::ccSet() {  // --cc
     m_outFormatOk = true;
     m_systemC = false;
@@ -554,16 +569,27 @@ int V3Options::stripOptionsForChildRun(const string& opt, bool forTop) {
     if (opt == "Mdir" || opt == "clk" || opt == "lib-create" || opt == "f" || opt == "F"
         || opt == "v" || opt == "l2-name" || opt == "mod-prefix" || opt == "prefix"
         || opt == "protect-lib" || opt == "protect-key" || opt == "threads"
-        || opt == "top-module") {
+        || opt == "top-module" || opt == "hierarchical-auto-size") {
         return 2;
     }
     if (opt == "build" || (!forTop && (opt == "cc" || opt == "exe" || opt == "sc"))
-        || opt == "hierarchical" || (opt.length() > 2 && opt.substr(0, 2) == "G=")) {
+        || opt == "hierarchical" || opt == "hierarchical=auto"
+        || (opt.length() > 2 && opt.substr(0, 2) == "G=")) {
         return 1;
     }
     return 0;
 }
 
+// Checks if an option, that is kept for child runs, differs between the child runs of
+// hierarchical Verilation, so must not be part of the --preproc-cache key.
+// Returns as stripOptionsForChildRun.
+int V3Options::stripOptionsForPreproc(const string& opt) {
+    if (opt == "hierarchical-child") return 3;
+    if (opt == "hierarchical-block" || opt == "hierarchical-params-file") return 2;
+    if (opt[0] == 'G') return 1;
+    return 0;
+}
+
 void V3Options::validateIdentifier(FileLine* fl, const string& arg, const string& opt) {
     if (!VString::isIdentifier(arg)) {
         fl->v3error(opt << " argument must be a legal C++ identifier: '" << arg << "'");
@@ -878,6 +904,11 @@ void V3Options::notify() VL_MT_DISABLED {
                 + ". Suggest see manual");
     }
 
+    if (m_build && m_outputInMemory) {
+        cmdfl->v3error("--output-in-memory cannot be used together with --build. Suggest see "
+                       "manual");
+    }
+
     if (m_exe && !v3Global.opt.libCreate().empty()) {
         cmdfl->v3error("--exe cannot be used together with --lib-create. Suggest see manual");
     }
@@ -920,6 +951,7 @@ void V3Options::notify() VL_MT_DISABLED {
         v3Global.opt.m_skipIdentical.setTrueOrFalse(  //
             !v3Global.opt.dpiHdrOnly()  //
             && !v3Global.opt.lintOnly()  //
+            && !v3Global.opt.outputInMemory()  //
             && !v3Global.opt.preprocOnly()  //
             && !v3Global.opt.serializeOnly());
     }
@@ -1178,6 +1210,16 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     // Minus options
     DECL_OPTION("-assert", OnOff, &m_assert);
     DECL_OPTION("-assert-case", OnOff, &m_assertCase);
+    DECL_OPTION("-assoc-storage", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "map") || !std::strcmp(valp, "hash")
+            || !std::strcmp(valp, "radix")) {
+            m_assocStorage = valp;
+        } else {
+            fl->v3fatal("Unknown setting for --assoc-storage: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'map', 'hash', or 'radix'");
+        }
+    });
     DECL_OPTION("-autoflush", OnOff, &m_autoflush);
 
     DECL_OPTION("-bbox-sys", OnOff, &m_bboxSys);
@@ -1257,12 +1299,15 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-debug-check", OnOff, &m_debugCheck);
     DECL_OPTION("-debug-collision", OnOff, &m_debugCollision).undocumented();
     DECL_OPTION("-debug-emitv", OnOff, &m_debugEmitV).undocumented();
+    DECL_OPTION("-debug-exit-after", Set, &m_debugExitAfter).undocumented();
     DECL_OPTION("-debug-exit-parse", OnOff, &m_debugExitParse).undocumented();
     DECL_OPTION("-debug-exit-uvm", OnOff, &m_debugExitUvm).undocumented();
     DECL_OPTION("-debug-exit-uvm23", OnOff, &m_debugExitUvm23).undocumented();
     DECL_OPTION("-debug-fatalsrc", CbCall, []() {
         v3fatalSrc("--debug-fatal-src");
     }).undocumented();  // See also --debug-abort
+    DECL_OPTION("-debug-fuzz-cov", OnOff, &m_debugFuzzCov).undocumented();
+    DECL_OPTION("-debug-fuzz-loop", Set, &m_debugFuzzLoop).undocumented();
     DECL_OPTION("-debug-leak", OnOff, &m_debugLeak);
     DECL_OPTION("-debug-nondeterminism", OnOff, &m_debugNondeterminism);
     DECL_OPTION("-debug-partition", OnOff, &m_debugPartition).undocumented();
@@ -1371,11 +1416,23 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         std::exit(0);
     });
 
-    DECL_OPTION("-hierarchical", OnOff, &m_hierarchical);
+    DECL_OPTION("-hierarchical", CbOnOff, [this](bool flag) {
+        m_hierarchical = flag;
+        if (!flag) m_hierarchicalAuto = false;
+    });
+    DECL_OPTION("-hierarchical=auto", CbCall, [this]() {
+        m_hierarchical = true;
+        m_hierarchicalAuto = true;
+    });
+    DECL_OPTION("-hierarchical-auto-size", CbVal, [this, fl](const char* valp) {
+        m_hierAutoSize = std::atoi(valp);
+        if (m_hierAutoSize <= 0) fl->v3error("--hierarchical-auto-size must be > 0: " << valp);
+    });
     DECL_OPTION("-hierarchical-block", CbVal, [this](const char* valp) {
         const V3HierarchicalBlockOption opt{valp};
         m_hierBlocks.emplace(opt.mangledName(), opt);
     });
+    DECL_OPTION("-hierarchical-cache", Set, &m_hierCache);
     DECL_OPTION("-hierarchical-child", Set, &m_hierChild);
     DECL_OPTION("-hierarchical-params-file", CbVal,
                 [this](const char* optp) { m_hierParamsFile = optp; });
@@ -1420,6 +1477,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     };
     DECL_OPTION("-default-language", CbVal, setLang);
     DECL_OPTION("-language", CbVal, setLang);
+    DECL_OPTION("-lazy-array-size", CbVal, [this, fl](const char* valp) {
+        m_lazyArraySize = std::atoi(valp);
+        if (m_lazyArraySize < 0) fl->v3error("--lazy-array-size must be >= 0: " << valp);
+    });
     DECL_OPTION("-lib-create", CbVal, [this, fl](const char* valp) {
         validateIdentifier(fl, valp, "--lib-create");
         m_libCreate = valp;
@@ -1464,6 +1525,9 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_outputGroups = std::atoi(valp);
         if (m_outputGroups < 0) { fl->v3error("--output-groups must be >= 0: " << valp); }
     });
+    DECL_OPTION("-output-groups-profile", Set, &m_outputGroupsProfile);
+    DECL_OPTION("-output-in-memory", OnOff, &m_outputInMemory);
+    DECL_OPTION("-output-stable-names", OnOff, &m_outputStableNames);
     DECL_OPTION("-output-split", Set, &m_outputSplit);
     DECL_OPTION("-output-split-cfuncs", CbVal, [this, fl](const char* valp) {
         m_outputSplitCFuncs = std::atoi(valp);
@@ -1498,6 +1562,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-pins-uint8", OnOff, &m_pinsUint8);
     DECL_OPTION("-pipe-filter", Set, &m_pipeFilter);
     DECL_OPTION("-pp-comments", OnOff, &m_ppComments);
+    DECL_OPTION("-preproc-cache", Set, &m_preprocCache);
     DECL_OPTION("-prefix", CbVal, [this, fl](const char* valp) {
         validateIdentifier(fl, valp, "--prefix");
         m_prefix = valp;
@@ -1507,6 +1572,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
     DECL_OPTION("-prof-pgo", OnOff, &m_profPgo);
+    DECL_OPTION("-prof-verilation", OnOff, &m_profVerilation);
     DECL_OPTION("-profile-cfuncs", CbCall,
                 [this]() { m_profC = m_profCFuncs = true; });  // Renamed
     DECL_OPTION("-protect-ids", OnOff, &m_protectIds);
@@ -1772,6 +1838,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
     DECL_OPTION("-waiver-multiline", OnOff, &m_waiverMultiline);
     DECL_OPTION("-waiver-output", Set, &m_waiverOutput);
+    DECL_OPTION("-write-if-changed", OnOff, &m_writeIfChanged);
 
     DECL_OPTION("-x-assign", CbVal, [this, fl](const char* valp) {
         if (!std::strcmp(valp, "0")) {
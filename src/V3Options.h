@@ -240,6 +240,7 @@ private:
     bool m_debugExitParse = false;  // main switch: --debug-exit-parse
     bool m_debugExitUvm = false;    // main switch: --debug-exit-uvm
     bool m_debugExitUvm23 = false;  // main switch: --debug-exit-uvm23
+    bool m_debugFuzzCov = false;    // main switch: --debug-fuzz-cov
     bool m_debugLeak = true;        // main switch: --debug-leak
     bool m_debugNondeterminism = false;  // main switch: --debug-nondeterminism
     bool m_debugPartition = false;  // main switch: --debug-partition
@@ -254,12 +255,15 @@ private:
     bool m_exe = false;             // main switch: --exe
     bool m_flatten = false;         // main switch: --flatten
     bool m_hierarchical = false;    // main switch: --hierarchical
+    bool m_hierarchicalAuto = false;  // main switch: --hierarchical=auto
     bool m_ignc = false;            // main switch: --ignc
     bool m_jsonOnly = false;        // main switch: --json-only
     bool m_lintOnly = false;        // main switch: --lint-only
     bool m_gmake = false;           // main switch: --make gmake
     bool m_main = false;            // main switch: --main
     bool m_outFormatOk = false;     // main switch: --cc, --sc or --sp was specified
+    bool m_outputInMemory = false;  // main switch: --output-in-memory
+    bool m_outputStableNames = false;  // main switch: --output-stable-names
     bool m_pedantic = false;        // main switch: --Wpedantic
     bool m_pinsInoutEnables = false;// main switch: --pins-inout-enables
     bool m_pinsScUint = false;      // main switch: --pins-sc-uint
@@ -271,6 +275,7 @@ private:
     bool m_profCFuncs = false;      // main switch: --prof-cfuncs
     bool m_profExec = false;        // main switch: --prof-exec
     bool m_profPgo = false;         // main switch: --prof-pgo
+    bool m_profVerilation = false;  // main switch: --prof-verilation
     bool m_protectIds = false;      // main switch: --protect-ids
     bool m_public = false;          // main switch: --public
     bool m_publicFlatRW = false;    // main switch: --public-flat-rw
@@ -301,20 +306,24 @@ private:
     bool m_verilate = true;         // main switch: --verilate
     bool m_vpi = false;             // main switch: --vpi
     bool m_waiverMultiline = false;  // main switch: --waiver-multiline
+    bool m_writeIfChanged = false;  // main switch: --write-if-changed
     bool m_xInitialEdge = false;    // main switch: --x-initial-edge
     bool m_xmlOnly = false;         // main switch: --xml-only
 
     int         m_buildJobs = -1;    // main switch: --build-jobs, -j
     int         m_convergeLimit = 100;  // main switch: --converge-limit
     int         m_coverageMaxWidth = 256; // main switch: --coverage-max-width
+    int         m_debugFuzzLoop = 0;  // main switch: --debug-fuzz-loop
     int         m_expandLimit = 64;  // main switch: --expand-limit
     int         m_gateStmts = 100;    // main switch: --gate-stmts
     int         m_hierChild = 0;      // main switch: --hierarchical-child
+    int         m_hierAutoSize = 50000;  // main switch: --hierarchical-auto-size
     int         m_ifDepth = 0;      // main switch: --if-depth
     int         m_inlineMult = 2000;   // main switch: --inline-mult
     int         m_instrCountDpi = 200;   // main switch: --instr-count-dpi
     bool        m_jsonEditNums = true; // main switch: --no-json-edit-nums
     bool        m_jsonIds = true; // main switch: --no-json-ids
+    int         m_lazyArraySize = 0;  // main switch: --lazy-array-size
     int         m_localizeMaxSize = 1024;  // main switch: --localize-max-size
     VOptionBool m_makeDepend;  // main switch: -MMD
     int         m_maxNumWidth = 65536;  // main switch: --max-num-width
@@ -347,9 +356,12 @@ private:
     int         m_compLimitMembers = 64;  // compiler selection; number of members in struct before make anon array
     int         m_compLimitParens = 240;  // compiler selection; number of nested parens
 
+    string      m_assocStorage = "map";  // main switch: --assoc-storage
     string      m_buildDepBin;  // main switch: --build-dep-bin {filename}
+    string      m_debugExitAfter;  // main switch: --debug-exit-after {stage}
     string      m_exeName;      // main switch: -o {name}
     string      m_flags;        // main switch: -f {name}
+    string      m_hierCache;    // main switch: --hierarchical-cache
     string      m_hierParamsFile; // main switch: --hierarchical-params-file
     string      m_jsonOnlyOutput;    // main switch: --json-only-output
     string      m_jsonOnlyMetaOutput;    // main switch: --json-only-meta-output
@@ -358,8 +370,10 @@ private:
     string      m_mainTopName;  // main switch: --main-top-name
     string      m_makeDir;      // main switch: -Mdir
     string      m_modPrefix;    // main switch: --mod-prefix
+    string      m_outputGroupsProfile;  // main switch: --output-groups-profile
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
+    string      m_preprocCache; // main switch: --preproc-cache
     string      m_protectKey;   // main switch: --protect-key
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
@@ -430,6 +444,9 @@ private:
     static string parseFileArg(const string& optdir, const string& relfilename);
     string filePathCheckOneDir(const string& modname, const string& dirname);
     static int stripOptionsForChildRun(const string& opt, bool forTop);
+    static int stripOptionsForPreproc(const string& opt);
+    string argsStringStripped(bool allArgs, bool forTop,
+                              int (*extraStripp)(const string& opt)) const;
     void validateIdentifier(FileLine* fl, const string& arg, const string& opt);
 
     // CONSTRUCTORS
@@ -481,6 +498,7 @@ public:
     bool bboxUnsup() const { return m_bboxUnsup; }
     bool binary() const { return m_binary; }
     bool build() const { return m_build; }
+    string assocStorage() const { return m_assocStorage; }
     string buildDepBin() const { return m_buildDepBin; }
     void buildDepBin(const string& flag) { m_buildDepBin = flag; }
     bool cmake() const { return m_cmake; }
@@ -498,6 +516,9 @@ public:
     bool debugExitParse() const { return m_debugExitParse; }
     bool debugExitUvm() const { return m_debugExitUvm; }
     bool debugExitUvm23() const { return m_debugExitUvm23; }
+    const string& debugExitAfter() const { return m_debugExitAfter; }
+    bool debugFuzzCov() const { return m_debugFuzzCov; }
+    int debugFuzzLoop() const { return m_debugFuzzLoop; }
     bool debugLeak() const { return m_debugLeak; }
     bool debugNondeterminism() const { return m_debugNondeterminism; }
     bool debugPartition() const { return m_debugPartition; }
@@ -540,6 +561,7 @@ public:
     bool profCFuncs() const { return m_profCFuncs; }
     bool profExec() const { return m_profExec; }
     bool profPgo() const { return m_profPgo; }
+    bool profVerilation() const { return m_profVerilation; }
     bool usesProfiler() const { return profExec() || profPgo(); }
     bool protectIds() const VL_MT_SAFE { return m_protectIds; }
     bool allPublic() const { return m_public; }
@@ -556,6 +578,7 @@ public:
     bool verilate() const { return m_verilate; }
     bool vpi() const { return m_vpi; }
     bool waiverMultiline() const { return m_waiverMultiline; }
+    bool writeIfChanged() const VL_MT_SAFE { return m_writeIfChanged; }
     bool xInitialEdge() const { return m_xInitialEdge; }
     bool xmlOnly() const { return m_xmlOnly; }
     bool serializeOnly() const { return m_xmlOnly || m_jsonOnly; }
@@ -576,9 +599,12 @@ public:
     VOptionBool makeDepend() const { return m_makeDepend; }
     int maxNumWidth() const { return m_maxNumWidth; }
     int moduleRecursionDepth() const { return m_moduleRecursion; }
+    int lazyArraySize() const { return m_lazyArraySize; }
     int outputSplit() const { return m_outputSplit; }
     int outputSplitCFuncs() const { return m_outputSplitCFuncs; }
     int outputSplitCTrace() const { return m_outputSplitCTrace; }
+    bool outputInMemory() const { return m_outputInMemory; }
+    bool outputStableNames() const { return m_outputStableNames; }
     int outputGroups() const { return m_outputGroups; }
     int pinsBv() const VL_MT_SAFE { return m_pinsBv; }
     int reloopLimit() const { return m_reloopLimit; }
@@ -633,8 +659,10 @@ public:
     string mainTopName() const { return m_mainTopName; }
     string makeDir() const VL_MT_SAFE { return m_makeDir; }
     string modPrefix() const VL_MT_SAFE { return m_modPrefix; }
+    string outputGroupsProfile() const { return m_outputGroupsProfile; }
     string pipeFilter() const { return m_pipeFilter; }
     string prefix() const VL_MT_SAFE { return m_prefix; }
+    string preprocCache() const { return m_preprocCache; }
     // Not just called protectKey() to avoid bugs of not using protectKeyDefaulted()
     bool protectKeyProvided() const { return !m_protectKey.empty(); }
     string protectKeyDefaulted() VL_MT_SAFE;  // Set default key if not set by user
@@ -716,6 +744,9 @@ public:
 
     bool hierarchical() const { return m_hierarchical; }
     int hierChild() const VL_MT_SAFE { return m_hierChild; }
+    bool hierarchicalAuto() const { return m_hierarchicalAuto; }
+    string hierCache() const { return m_hierCache; }
+    int hierAutoSize() const { return m_hierAutoSize; }
     bool hierTop() const VL_MT_SAFE { return !m_hierChild && !m_hierBlocks.empty(); }
     const V3HierBlockOptSet& hierBlocks() const { return m_hierBlocks; }
     // Directory to save .tree, .dot, .dat, .vpp for hierarchical block top
@@ -731,6 +762,8 @@ public:
     // Return options for child hierarchical blocks when forTop==false, otherwise returns args for
     // the top module.
     string allArgsStringForHierBlock(bool forTop) const;
+    // Return options that may affect preprocessing, so are common to hierarchical block runs
+    string allArgsStringForPreproc() const;
     void parseOpts(FileLine* fl, int argc, char** argv) VL_MT_DISABLED;
     void parseOptsList(FileLine* fl, const string& optdir, int argc, char** argv) VL_MT_DISABLED;
     void parseOptsFile(FileLine* fl, const string& filename, bool rel) VL_MT_DISABLED;
@@ -26,10 +26,13 @@
 
 #include "V3Ast.h"
 #include "V3Graph.h"
+#include "V3Hasher.h"
 #include "V3OrderGraph.h"
 
 #include <limits>
 #include <map>
+#include <set>
+#include <tuple>
 #include <vector>
 
 class V3OrderCFuncEmitter final {
@@ -53,6 +56,15 @@ class V3OrderCFuncEmitter final {
     AstCFunc* m_funcp = nullptr;
     // Function ordinals to ensure unique names
     std::map<std::pair<AstNodeModule*, std::string>, unsigned> m_funcNums;
+    // Whether to name functions by content hash, see '--output-stable-names'
+    const bool m_stableNames = v3Global.opt.outputStableNames();
+    // Functions created since the last rename, with the name prefix/suffix around the ordinal
+    std::vector<std::tuple<AstCFunc*, std::string, std::string>> m_toRename;
+    // Content based names already used
+    std::set<std::pair<AstNodeModule*, std::string>> m_stableNamesUsed;
+    // Parts of the last name returned by cfuncName, before and after the ordinal
+    std::string m_namePrefix;
+    std::string m_nameSuffix;
     // The result Active blocks that must be invoked to run the code in the order it was emitted
     std::vector<AstActive*> m_activeps;
 
@@ -62,9 +74,32 @@ class V3OrderCFuncEmitter final {
         std::string name = "_" + m_tag;
         name += domainp->isMulti() ? "_comb" : "_sequent";
         name += "__" + scopep->nameDotless();
-        name += "__" + std::to_string(m_funcNums[{modp, name}]++);
-        if (v3Global.opt.profCFuncs()) name += "__PROF__" + flp->profileFuncname();
-        return name;
+        const unsigned num = m_funcNums[{modp, name}]++;
+        m_namePrefix = name + "__";
+        m_nameSuffix = v3Global.opt.profCFuncs() ? "__PROF__" + flp->profileFuncname() : "";
+        return m_namePrefix + std::to_string(num) + m_nameSuffix;
+    }
+
+    // With '--output-stable-names', replace the ordinal in the names of the functions created
+    // so far with a hash of their contents, so the name does not depend on what other logic
+    // was emitted before them. This keeps the generated code for unchanged logic identical
+    // when an unrelated part of the design is edited.
+    void renameByContent() {
+        for (const auto& item : m_toRename) {
+            AstCFunc* const funcp = std::get<0>(item);
+            AstNodeModule* const modp = funcp->scopep()->modp();
+            V3Hash hash;
+            for (AstNode* nodep = funcp->stmtsp(); nodep; nodep = nodep->nextp()) {
+                hash += V3Hasher::uncachedHash(nodep);
+            }
+            const std::string base = std::get<1>(item) + "h" + hash.toString();
+            std::string name = base;
+            for (unsigned n = 0; !m_stableNamesUsed.emplace(modp, name).second; ++n) {
+                name = base + "_" + std::to_string(n);
+            }
+            funcp->name(name + std::get<2>(item));
+        }
+        m_toRename.clear();
     }
 
 public:
@@ -84,6 +119,7 @@ public:
     // Retrieve Active block, which when executed will call the constructed functions
     std::vector<AstActive*> getAndClearActiveps() {
         forceNewFunction();
+        if (m_stableNames) renameByContent();
         return std::move(m_activeps);
     }
 
@@ -142,6 +178,7 @@ public:
                 m_funcp->isLoose(true);
                 m_funcp->slow(slow);
                 scopep->addBlocksp(m_funcp);
+                if (m_stableNames) m_toRename.emplace_back(m_funcp, m_namePrefix, m_nameSuffix);
                 // Create call to the new functino
                 AstCCall* const callp = new AstCCall{flp, m_funcp};
                 callp->dtypeSetVoid();
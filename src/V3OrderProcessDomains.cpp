@@ -157,7 +157,7 @@ class V3OrderProcessDomains final {
     void processEdgeReport() {
         // Make report of all signal names and what clock edges they have
         const string filename = v3Global.debugFilename(m_tag + "_order_edges.txt");
-        const std::unique_ptr<std::ofstream> logp{V3File::new_ofstream(filename)};
+        const std::unique_ptr<std::ostream> logp{V3File::new_ostream(filename)};
         if (logp->fail()) v3fatal("Can't write " << filename);
 
         std::deque<string> report;
@@ -476,6 +476,38 @@ int V3Os::system(const string& command) {
     }
 }
 
+int V3Os::forkRun(const std::function<int()>& childFunc) {
+#if defined(_WIN32) || defined(__MINGW32__)
+    v3fatal("Unsupported: fork() on this platform");
+    return -1;
+#else
+    // Flush so buffered output is not duplicated into the child
+    std::cout.flush();
+    std::cerr.flush();
+    const pid_t pid = ::fork();
+    if (VL_UNCOVERABLE(pid < 0)) {
+        v3fatal("Failed to fork: " << std::strerror(errno));  // LCOV_EXCL_LINE
+        return -1;  // LCOV_EXCL_LINE
+    }
+    if (pid == 0) {
+        const int exit_code = childFunc();
+        std::cout.flush();
+        std::cerr.flush();
+        VL_GCOV_DUMP();  // _exit() skips static destructors, so must be called manually.
+        ::_exit(exit_code);
+    }
+    int status = 0;
+    while (::waitpid(pid, &status, 0) < 0) {
+        if (VL_UNCOVERABLE(errno != EINTR)) {
+            v3fatal("Failed to wait for child: " << std::strerror(errno));  // LCOV_EXCL_LINE
+            return -1;  // LCOV_EXCL_LINE
+        }
+    }
+    if (WIFSIGNALED(status)) return -WTERMSIG(status);
+    return WEXITSTATUS(status);
+#endif
+}
+
 void V3Os::selfTest() {
 #ifdef VL_DEBUG
     UASSERT_SELFTEST(string, filenameCleanup(""), "");
@@ -21,6 +21,7 @@
 #include "verilatedos.h"
 
 #include <array>
+#include <functional>
 
 // Limited V3 headers here - this is a base class for Vlc etc
 #include "V3Error.h"
@@ -81,6 +82,9 @@ public:
     // METHODS (sub command)
     /// Run system command, returns the exit code of the child process.
     static int system(const string& command);
+    /// Run function in a forked copy of this process, returns the function's return value
+    /// as the child exit code, or the negated signal number if the child was killed.
+    static int forkRun(const std::function<int()>& childFunc);
     static void selfTest();
 };
 
@@ -328,12 +328,12 @@ void V3ParseImp::parseFile(FileLine* fileline, const string& modfilename, bool i
         // Create output file with all the preprocessor output we buffered up
         const string vppfilename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
                                    + "__" + nondirname + ".vpp";
-        std::ofstream* ofp = nullptr;
+        std::ostream* ofp = nullptr;
         std::ostream* osp;
         if (v3Global.opt.preprocOnly()) {
             osp = &cout;
         } else {
-            osp = ofp = V3File::new_ofstream(vppfilename);
+            osp = ofp = V3File::new_ostream(vppfilename);
         }
         if (osp->fail()) {
             fileline->v3error("Cannot write preprocessor output: " + vppfilename);
@@ -344,10 +344,7 @@ void V3ParseImp::parseFile(FileLine* fileline, const string& modfilename, bool i
         } else {
             preprocDumps(*osp, false);
         }
-        if (ofp) {
-            ofp->close();
-            VL_DO_DANGLING(delete ofp, ofp);
-        }
+        if (ofp) VL_DO_DANGLING(delete ofp, ofp);
     }
 
     V3Stats::addStatSum(V3Stats::STAT_SOURCE_CHARS, m_ppBytes);
@@ -369,7 +366,7 @@ void V3ParseImp::dumpInputsFile() {
     static bool append = false;
     const string vppfilename
         = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix() + "__inputs.vpp";
-    std::ofstream* ofp = V3File::new_ofstream(vppfilename, append);
+    std::ostream* ofp = V3File::new_ostream(vppfilename, append);
     if (ofp->fail()) {
         v3error("Cannot write preprocessor output: " + vppfilename);
         return;
@@ -384,7 +381,6 @@ void V3ParseImp::dumpInputsFile() {
     }
     *ofp << "\n";
     preprocDumps(*ofp, true);
-    ofp->close();
     VL_DO_DANGLING(delete ofp, ofp);
 }
 
@@ -0,0 +1,141 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Per-pass profile of Verilator itself
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3PassProfile's Transformations:
+//
+// A pass spans from the end of the previous stage (or boot) to the call of
+// V3Global::dumpCheckGlobalTree that ends it.  The main thread is trace
+// thread 0, thread pool workers are numbered in order of first job.
+//
+// The output is the Chrome trace event format, which can be loaded into
+// chrome://tracing, Perfetto (ui.perfetto.dev) or speedscope.
+//
+//*************************************************************************
+
+#include "V3PassProfile.h"
+
+#include "V3File.h"
+#include "V3Global.h"
+#include "V3Mutex.h"
+#include "V3PoolAlloc.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+namespace {
+struct PassProfileEvent final {
+    std::string m_name;  // Pass name, or empty for a thread pool job
+    uint64_t m_startUs;  // Start, microseconds since boot
+    uint64_t m_endUs;  // End, microseconds since boot
+    int m_tid;  // Trace thread number
+    double m_cpuSec;  // Process CPU time used, all threads
+    int64_t m_memDelta;  // Change in memory usage, bytes
+    uint64_t m_memBytes;  // Memory usage at end, bytes
+    uint64_t m_allocs;  // Pooled allocations made
+};
+
+V3Mutex s_mutex;  // Protects s_events
+std::vector<PassProfileEvent> s_events VL_GUARDED_BY(s_mutex);  // Recorded events
+std::atomic<int> s_nextTid{1};  // Next worker trace thread number
+thread_local int t_tid = 0;  // Trace thread number of this thread, 0 = not yet assigned
+
+VlOs::DeltaWallTime s_wallTime{false};  // Time since boot
+VlOs::DeltaCpuTime s_cpuTime{false};  // CPU time since boot
+uint64_t s_lastUs = 0;  // End of previous pass
+double s_lastCpuSec = 0;  // CPU time at end of previous pass
+uint64_t s_lastMem = 0;  // Memory usage at end of previous pass
+uint64_t s_lastAllocs = 0;  // Pooled allocations at end of previous pass
+}  // namespace
+
+bool V3PassProfile::s_enabled = false;
+
+void V3PassProfile::boot() {
+    s_enabled = true;
+    s_wallTime.start();
+    s_cpuTime.start();
+    s_lastMem = VlOs::memUsageBytes();
+    s_lastAllocs = V3PoolAlloc::allocations();
+}
+
+uint64_t V3PassProfile::now() VL_MT_SAFE {
+    return static_cast<uint64_t>(s_wallTime.deltaTime() * 1.0e6);
+}
+
+void V3PassProfile::stageEnd(const std::string& name) {
+    const uint64_t nowUs = now();
+    const double cpuSec = s_cpuTime.deltaTime();
+    const uint64_t mem = VlOs::memUsageBytes();
+    const uint64_t allocs = V3PoolAlloc::allocations();
+    {
+        const V3LockGuard lock{s_mutex};
+        s_events.push_back({name, s_lastUs, nowUs, 0, cpuSec - s_lastCpuSec,
+                            static_cast<int64_t>(mem) - static_cast<int64_t>(s_lastMem), mem,
+                            allocs - s_lastAllocs});
+    }
+    s_lastUs = nowUs;
+    s_lastCpuSec = cpuSec;
+    s_lastMem = mem;
+    s_lastAllocs = allocs;
+}
+
+void V3PassProfile::jobDone(uint64_t startUs, uint64_t endUs) VL_MT_SAFE {
+    if (!t_tid) t_tid = s_nextTid++;
+    const V3LockGuard lock{s_mutex};
+    s_events.push_back({"", startUs, endUs, t_tid, 0, 0, 0, 0});
+}
+
+void V3PassProfile::write() {
+    const std::string filename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                                 + "__prof_verilation.json";
+    const std::unique_ptr<std::ostream> ofp{V3File::new_ostream(filename)};
+    if (ofp->fail()) v3fatal("Can't write " << filename);
+    std::ostream& os = *ofp;
+
+    const V3LockGuard lock{s_mutex};
+    os << "{\"displayTimeUnit\": \"ms\",\n";
+    os << " \"otherData\": {\"version\": \"" << V3Options::version() << "\"},\n";
+    os << " \"traceEvents\": [\n";
+    os << "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0,"
+          " \"args\": {\"name\": \"main\"}}";
+    for (int tid = 1; tid < s_nextTid; ++tid) {
+        os << ",\n  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << tid
+           << ", \"args\": {\"name\": \"worker " << tid << "\"}}";
+    }
+    for (const PassProfileEvent& event : s_events) {
+        os << ",\n  {\"name\": \"" << (event.m_name.empty() ? "job" : event.m_name) << "\""
+           << ", \"cat\": \"" << (event.m_name.empty() ? "threadpool" : "pass") << "\""
+           << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.m_tid
+           << ", \"ts\": " << event.m_startUs << ", \"dur\": " << event.m_endUs - event.m_startUs;
+        if (!event.m_name.empty()) {
+            os << ", \"args\": {\"cpu_sec\": " << event.m_cpuSec
+               << ", \"mem_delta_bytes\": " << event.m_memDelta
+               << ", \"mem_bytes\": " << event.m_memBytes
+               << ", \"pooled_allocs\": " << event.m_allocs << "}";
+        }
+        os << "}";
+    }
+    // Memory usage as a counter track
+    for (const PassProfileEvent& event : s_events) {
+        if (event.m_name.empty()) continue;
+        os << ",\n  {\"name\": \"memory\", \"ph\": \"C\", \"pid\": 1, \"ts\": " << event.m_endUs
+           << ", \"args\": {\"bytes\": " << event.m_memBytes << "}}";
+    }
+    os << "\n ]\n}\n";
+}
@@ -0,0 +1,49 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Per-pass profile of Verilator itself
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3PASSPROFILE_H_
+#define VERILATOR_V3PASSPROFILE_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <string>
+
+//######################################################################
+// V3PassProfile -- With --prof-verilation, record the wall time, CPU time,
+// memory change and pooled allocations of every pass, and the activity of
+// V3ThreadPool workers, then write them as a Chrome trace event file.
+// Disabled (a single flag test) otherwise.
+
+class V3PassProfile final {
+    static bool s_enabled;  // Recording is on
+
+public:
+    // METHODS
+    // Start recording; passes are measured from this point
+    static void boot();
+    static bool enabled() VL_MT_SAFE { return s_enabled; }
+    // A pass completed; called from V3Global::dumpCheckGlobalTree
+    static void stageEnd(const std::string& name);
+    // Record a thread pool job that ran on the calling thread, with times from now()
+    static void jobDone(uint64_t startUs, uint64_t endUs) VL_MT_SAFE;
+    // Microseconds since boot
+    static uint64_t now() VL_MT_SAFE;
+    // Write the trace file
+    static void write();
+};
+
+#endif  // Guard
@@ -0,0 +1,79 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Pooled allocator for AST and DFG objects
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "V3PoolAlloc.h"
+
+#include "V3Error.h"
+#include "V3Mutex.h"
+#include "V3Stats.h"
+
+//######################################################################
+// V3PoolAlloc
+
+V3PoolAlloc* V3PoolAlloc::s_headp = nullptr;
+thread_local V3PoolAlloc* V3PoolAlloc::t_poolp = nullptr;
+
+static V3Mutex s_poolListMutex;  // Protects V3PoolAlloc::s_headp
+
+V3PoolAlloc& V3PoolAlloc::newPool() {
+    // Pools are never deleted, as objects from them may outlive the thread
+    V3PoolAlloc* const poolp = new V3PoolAlloc;
+    {
+        const V3LockGuard lock{s_poolListMutex};
+        poolp->m_nextp = s_headp;
+        s_headp = poolp;
+    }
+    t_poolp = poolp;
+    return *poolp;
+}
+
+void* V3PoolAlloc::allocateChunk(size_t bytes) {
+    // The unused tail of the previous chunk is abandoned; it is below one object size
+    char* const chunkp = static_cast<char*>(::operator new(CHUNK_SIZE));
+    statInc(m_chunks);
+    m_bumpp = chunkp + bytes;
+    m_bumpEndp = chunkp + CHUNK_SIZE;
+    return chunkp;
+}
+
+uint64_t V3PoolAlloc::allocations() {
+    uint64_t allocs = 0;
+    const V3LockGuard lock{s_poolListMutex};
+    for (const V3PoolAlloc* poolp = s_headp; poolp; poolp = poolp->m_nextp) {
+        allocs += poolp->m_allocs.load(std::memory_order_relaxed);
+    }
+    return allocs;
+}
+
+void V3PoolAlloc::addStats() {
+    uint64_t allocs = 0;
+    uint64_t reuses = 0;
+    uint64_t frees = 0;
+    uint64_t chunks = 0;
+    {
+        const V3LockGuard lock{s_poolListMutex};
+        for (const V3PoolAlloc* poolp = s_headp; poolp; poolp = poolp->m_nextp) {
+            allocs += poolp->m_allocs.load(std::memory_order_relaxed);
+            reuses += poolp->m_reuses.load(std::memory_order_relaxed);
+            frees += poolp->m_frees.load(std::memory_order_relaxed);
+            chunks += poolp->m_chunks.load(std::memory_order_relaxed);
+        }
+    }
+    V3Stats::addStat("Allocator, Pooled objects allocated", allocs);
+    V3Stats::addStat("Allocator, Pooled objects reused", reuses);
+    V3Stats::addStat("Allocator, Pooled objects freed", frees);
+    V3Stats::addStat("Allocator, Pooled bytes reserved", chunks * CHUNK_SIZE);
+}
@@ -0,0 +1,127 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Pooled allocator for AST and DFG objects
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3POOLALLOC_H_
+#define VERILATOR_V3POOLALLOC_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+//######################################################################
+// V3PoolAlloc -- Size class free list allocator behind AstNode and
+// DfgVertex operator new.  Objects are carved from large chunks, and a
+// freed object is kept on the free list of its size class to be handed
+// out again, so passes that create and destroy many temporaries do not
+// go through malloc.  Each thread has its own pool, so no locking is
+// needed, and an object may be freed on another thread than allocated
+// it.
+//
+// Chunks are only released when the process exits, and memory freed in
+// one size class is never reused for another.  Chunks hold live objects
+// of all size classes interleaved, so they cannot be returned to the
+// system at pass boundaries without moving objects.  Reserved memory is
+// therefore the sum of each size class's high-water mark, which on long
+// runs can exceed the peak of the AST as a whole.  In exchange allocation
+// and free are a few instructions.  "Allocator, Pooled bytes reserved" in
+// --stats shows the cost.
+
+class V3PoolAlloc final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 16;  // Size class step, also the alignment
+    static constexpr size_t MAX_SIZE = 1024;  // Larger objects use the global operator new
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;  // Bytes requested from the system at once
+
+    // TYPES
+    struct FreeItem final {
+        FreeItem* m_nextp;  // Next free object of same size class
+    };
+
+    // STATE
+    std::array<FreeItem*, MAX_SIZE / GRANULE> m_freeps{};  // Free list head per size class
+    char* m_bumpp = nullptr;  // Next unused byte in current chunk
+    char* m_bumpEndp = nullptr;  // End of current chunk
+    V3PoolAlloc* m_nextp = nullptr;  // Next pool in list of all pools
+    // Statistics are only written by the owning thread, but read by any thread
+    std::atomic<uint64_t> m_allocs{0};  // Statistic: objects allocated
+    std::atomic<uint64_t> m_reuses{0};  // Statistic: allocations satisfied from a free list
+    std::atomic<uint64_t> m_frees{0};  // Statistic: objects freed
+    std::atomic<uint64_t> m_chunks{0};  // Statistic: chunks requested from the system
+
+    static V3PoolAlloc* s_headp;  // List of all pools, for statistics
+    static thread_local V3PoolAlloc* t_poolp;  // Pool of the current thread
+
+    // CONSTRUCTORS
+    V3PoolAlloc() = default;
+    ~V3PoolAlloc() = default;
+    VL_UNCOPYABLE(V3PoolAlloc);
+
+    // METHODS
+    static size_t sizeClass(size_t size) { return (size - 1) / GRANULE; }
+    // Increment a statistic; single writer, so no atomic read-modify-write needed
+    static void statInc(std::atomic<uint64_t>& stat) {
+        stat.store(stat.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    static V3PoolAlloc& pool() { return VL_LIKELY(t_poolp) ? *t_poolp : newPool(); }
+    static V3PoolAlloc& newPool();
+    void* allocateChunk(size_t bytes);
+
+public:
+    // Allocate object of 'size' bytes; used by operator new
+    static void* allocate(size_t size) {
+        if (VL_UNLIKELY(size > MAX_SIZE || size == 0)) return ::operator new(size);
+        V3PoolAlloc& self = pool();
+        statInc(self.m_allocs);
+        const size_t sc = sizeClass(size);
+        if (FreeItem* const itemp = self.m_freeps[sc]) {
+            self.m_freeps[sc] = itemp->m_nextp;
+            statInc(self.m_reuses);
+            return itemp;
+        }
+        const size_t bytes = (sc + 1) * GRANULE;
+        if (VL_UNLIKELY(static_cast<size_t>(self.m_bumpEndp - self.m_bumpp) < bytes)) {
+            return self.allocateChunk(bytes);
+        }
+        void* const objp = self.m_bumpp;
+        self.m_bumpp += bytes;
+        return objp;
+    }
+    // Free object previously returned by allocate(size); used by operator delete
+    static void deallocate(void* objp, size_t size) {
+        if (!objp) return;
+        if (VL_UNLIKELY(size > MAX_SIZE || size == 0)) {
+            ::operator delete(objp);
+            return;
+        }
+        V3PoolAlloc& self = pool();
+        statInc(self.m_frees);
+        FreeItem* const itemp = static_cast<FreeItem*>(objp);
+        const size_t sc = sizeClass(size);
+        itemp->m_nextp = self.m_freeps[sc];
+        self.m_freeps[sc] = itemp;
+    }
+    // Total objects allocated by all threads
+    static uint64_t allocations();
+    // Add allocator statistics of all threads to V3Stats
+    static void addStats();
+};
+
+#endif  // Guard
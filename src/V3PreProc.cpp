@@ -261,6 +261,8 @@ public:
     void insertUnreadbackAtBol(const string& text);
     void addLineComment(int enterExit);
     void dumpDefines(std::ostream& os) override;
+    void saveDefines(std::ostream& os) override;
+    bool loadDefines(std::istream& is) override;
     void candidateDefines(VSpellCheck* spellerp) override;
 
     // METHODS, callbacks
@@ -917,6 +919,40 @@ void V3PreProcImp::dumpDefines(std::ostream& os) {
     }
 }
 
+void V3PreProcImp::saveDefines(std::ostream& os) {
+    os << m_defines.size() << '\n';
+    for (const auto& it : m_defines) {
+        saveField(os, it.first);
+        saveField(os, it.second.value());
+        saveField(os, it.second.params());
+        saveField(os, it.second.fileline()->filename());
+        os << ' ' << it.second.fileline()->lineno() << ' ' << it.second.cmdline() << '\n';
+    }
+}
+
+bool V3PreProcImp::loadDefines(std::istream& is) {
+    DefinesMap defines;
+    size_t count = 0;
+    if (!(is >> count)) return false;
+    for (size_t i = 0; i < count; ++i) {
+        string name;
+        string value;
+        string params;
+        string filename;
+        int lineno = 0;
+        bool cmdline = false;
+        if (!loadField(is, name) || !loadField(is, value) || !loadField(is, params)
+            || !loadField(is, filename) || !(is >> lineno >> cmdline)) {
+            return false;
+        }
+        FileLine* const fl = new FileLine{filename};
+        fl->lineno(lineno);
+        defines.emplace(name, VDefine{fl, value, params, cmdline});
+    }
+    m_defines = std::move(defines);
+    return true;
+}
+
 void V3PreProcImp::candidateDefines(VSpellCheck* spellerp) {
     for (DefinesMap::const_iterator it = m_defines.begin(); it != m_defines.end(); ++it) {
         spellerp->pushCandidate("`"s + it->first);
@@ -88,6 +88,17 @@ public:
     void error(const string& msg) { fileline()->v3error(msg); }  ///< Report an error
     void fatal(const string& msg) { fileline()->v3fatalSrc(msg); }  ///< Report a fatal error
     virtual void dumpDefines(std::ostream& os) = 0;  ///< Print list of `defines
+    virtual void saveDefines(std::ostream& os) = 0;  ///< Serialize `defines for loadDefines
+    virtual bool loadDefines(std::istream& is) = 0;  ///< Replace `defines from saveDefines
+    // Length-prefixed string for saveDefines and similar, as values may contain newlines
+    static void saveField(std::ostream& os, const string& str) { os << str.size() << ':' << str; }
+    static bool loadField(std::istream& is, string& str) {
+        size_t size = 0;
+        char colon = '\0';
+        if (!(is >> size) || !is.get(colon) || colon != ':') return false;
+        str.resize(size);
+        return size == 0 || static_cast<bool>(is.read(&str[0], size));
+    }
     virtual void candidateDefines(VSpellCheck* spellerp) = 0;  ///< Spell check candidate defines
 
 protected:
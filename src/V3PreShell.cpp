@@ -26,9 +26,14 @@
 #include "V3Os.h"
 #include "V3Parse.h"
 #include "V3PreProc.h"
+#include "V3String.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -41,6 +46,9 @@ protected:
     static V3PreShellImp s_preImp;
     static V3PreProc* s_preprocp;
     static VInFilter* s_filterp;
+    static constexpr const char* CACHE_HEADER = "// Verilator preprocessor cache v1";
+
+    std::vector<string> m_includes;  // Files included by the current top file, for caching
 
     //---------------------------------------
     // METHODS
@@ -91,7 +99,7 @@ protected:
 
         // Preprocess
         s_filterp = filterp;
-        const string modfilename = preprocOpen(fl, s_filterp, modname, "", errmsg);
+        const string modfilename = preprocFind(fl, modname, "", errmsg);
         if (modfilename.empty()) return false;
 
         // Set language standard up front
@@ -107,9 +115,25 @@ protected:
             // FileLine tracks and frees modfileline
         }
 
+        const string cacheFilename = preprocCacheFilename(modfilename);
+        if (!cacheFilename.empty() && preprocCacheLoad(cacheFilename, modfilename, parsep)) {
+            return true;
+        }
+
+        UINFO(2, "    Reading " << modfilename << endl);
+        s_preprocp->openFile(fl, s_filterp, modfilename);
+        m_includes.clear();
+        const int msgsBefore = V3Error::errorCount() + V3Error::warnCount();
+        string text;
         while (!s_preprocp->isEof()) {
             const string line = s_preprocp->getline();
             V3Parse::ppPushText(parsep, line);
+            if (!cacheFilename.empty()) text += line;
+        }
+        // Messages would not be repeated when reusing the output, so don't cache
+        if (!cacheFilename.empty()
+            && msgsBefore == V3Error::errorCount() + V3Error::warnCount()) {
+            preprocCacheStore(cacheFilename, text);
         }
         return true;
     }
@@ -120,8 +144,10 @@ protected:
                        "Suggest `include with absolute path be made relative, and use +include: "
                            << modname);
         }
-        preprocOpen(fl, s_filterp, modname, V3Os::filenameDir(fl->filename()),
-                    "Cannot find include file: ");
+        const string filename = preprocOpen(fl, s_filterp, modname,
+                                            V3Os::filenameDir(fl->filename()),
+                                            "Cannot find include file: ");
+        if (!filename.empty()) m_includes.push_back(filename);
     }
 
 private:
@@ -129,6 +155,16 @@ private:
                        const string& lastpath,
                        const string& errmsg) {  // Error message or "" to suppress
         // Returns filename if successful
+        const string filename = preprocFind(fl, modname, lastpath, errmsg);
+        if (filename == "") return "";  // Not found
+
+        UINFO(2, "    Reading " << filename << endl);
+        s_preprocp->openFile(fl, filterp, filename);
+        return filename;
+    }
+    string preprocFind(FileLine* fl, const string& modname, const string& lastpath,
+                       const string& errmsg) {  // Error message or "" to suppress
+        // Returns filename if found
         // Try a pure name in case user has a bogus `filename they don't expect
         string filename = v3Global.opt.filePath(fl, modname, lastpath, errmsg);
         if (filename == "") {
@@ -138,13 +174,85 @@ private:
 
             filename = v3Global.opt.filePath(fl, ppmodname, lastpath, errmsg);
         }
-        if (filename == "") return "";  // Not found
-
-        UINFO(2, "    Reading " << filename << endl);
-        s_preprocp->openFile(fl, filterp, filename);
         return filename;
     }
 
+    // --preproc-cache support
+    static string preprocCacheDigest(const string& filename) {
+        VInFilter::StrList contents;
+        if (!s_filterp->readWholefile(filename, contents)) return "-";
+        VHashSha256 hash;
+        for (const string& str : contents) hash.insert(str);
+        return hash.digestHex();
+    }
+    string preprocCacheFilename(const string& modfilename) {
+        // Returns cache entry name for the file given the current state, or "" if no caching
+        if (v3Global.opt.preprocCache().empty()) return "";
+        std::ostringstream defines;
+        s_preprocp->saveDefines(defines);
+        VHashSha256 hash{V3Options::version()};
+        hash.insert(v3Global.opt.allArgsStringForPreproc());
+        hash.insert(modfilename);
+        hash.insert(preprocCacheDigest(modfilename));
+        hash.insert(defines.str());
+        return v3Global.opt.preprocCache() + "/" + V3Os::filenameNonDirExt(modfilename) + "__"
+               + hash.digestSymbol() + ".vpp";
+    }
+    bool preprocCacheLoad(const string& cacheFilename, const string& modfilename,
+                          V3ParseImp* parsep) {
+        // Read everything before changing any state, so a bad entry is just a miss
+        std::ifstream is{cacheFilename, std::ios::binary};
+        if (!is) return false;
+        string header;
+        if (!std::getline(is, header) || header != CACHE_HEADER) return false;
+        size_t count = 0;
+        if (!(is >> count)) return false;
+        std::vector<string> includes;
+        for (size_t i = 0; i < count; ++i) {
+            string filename;
+            string digest;
+            if (!V3PreProc::loadField(is, filename) || !(is >> digest)) return false;
+            if (preprocCacheDigest(filename) != digest) {
+                UINFO(2, "    --preproc-cache: Stale due to " << filename << endl);
+                return false;
+            }
+            includes.push_back(filename);
+        }
+        string defines;
+        string text;
+        if (!V3PreProc::loadField(is, defines) || !V3PreProc::loadField(is, text)) return false;
+        std::istringstream definesIs{defines};
+        if (!s_preprocp->loadDefines(definesIs)) return false;
+
+        UINFO(2, "    --preproc-cache: Reusing " << cacheFilename << endl);
+        V3File::addSrcDepend(modfilename);
+        for (const string& filename : includes) V3File::addSrcDepend(filename);
+        V3Parse::ppPushText(parsep, text);
+        return true;
+    }
+    void preprocCacheStore(const string& cacheFilename, const string& text) {
+        // Best effort; if the cache can't be written the next run just preprocesses again
+        V3Os::createDir(v3Global.opt.preprocCache());
+        const string tmpFilename = cacheFilename + ".tmp";
+        {
+            std::ofstream os{tmpFilename, std::ios::binary};
+            if (!os) return;
+            os << CACHE_HEADER << '\n' << m_includes.size() << '\n';
+            for (const string& filename : m_includes) {
+                V3PreProc::saveField(os, filename);
+                os << ' ' << preprocCacheDigest(filename) << '\n';
+            }
+            std::ostringstream defines;
+            s_preprocp->saveDefines(defines);
+            V3PreProc::saveField(os, defines.str());
+            V3PreProc::saveField(os, text);
+            if (!os) return;
+        }
+        if (std::rename(tmpFilename.c_str(), cacheFilename.c_str()) == 0) {
+            UINFO(2, "    --preproc-cache: Wrote " << cacheFilename << endl);
+        }
+    }
+
 public:
     // CONSTRUCTORS
     V3PreShellImp() = default;
@@ -182,4 +182,5 @@ void V3Stats::statsStageAll(AstNetlist* nodep, const std::string& stage, bool fa
 void V3Stats::statsFinalAll(AstNetlist* nodep) {
     statsStageAll(nodep, "Final all");
     statsStageAll(nodep, "Final fast", true);
+    V3PoolAlloc::addStats();
 }
@@ -83,7 +83,7 @@ public:
     bool sumit() const VL_MT_SAFE { return m_sumit; }
     bool perf() const VL_MT_SAFE { return m_perf; }
     bool printit() const VL_MT_SAFE { return m_printit; }
-    virtual void dump(std::ofstream& os) const VL_MT_SAFE;
+    virtual void dump(std::ostream& os) const VL_MT_SAFE;
     void combineWith(V3Statistic* otherp) {
         m_value += otherp->value();
         otherp->m_printit = false;
@@ -144,7 +144,7 @@ public:
     /// Called by the top level to dump the statistics
     static void statsReport();
     /// Called by debug dumps
-    static void infoHeader(std::ofstream& os, const string& prefix);
+    static void infoHeader(std::ostream& os, const string& prefix);
     /// Called for final build report
     static void summaryReport();
 };
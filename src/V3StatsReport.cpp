@@ -34,7 +34,7 @@ class StatsReport final {
     using StatColl = std::vector<V3Statistic>;
 
     // STATE
-    std::ofstream& os;  ///< Output stream
+    std::ostream& os;  ///< Output stream
     static StatColl s_allStats;  ///< All statistics
 
     static void sumit() {
@@ -174,10 +174,11 @@ public:
     static void calculate() { sumit(); }
 
     // CONSTRUCTORS
-    explicit StatsReport(std::ofstream* aofp)
+    explicit StatsReport(std::ostream* aofp)
         : os(*aofp) {  // Need () or GCC 4.8 false warning
         os << "Verilator Statistics Report\n\n";
         V3Stats::infoHeader(os, "");
+        os << "  Last stage: " << v3Global.lastStage() << '\n';
         sumit();
         stars();
         stages();
@@ -190,7 +191,7 @@ StatsReport::StatColl StatsReport::s_allStats;
 //######################################################################
 // V3Statstic class
 
-void V3Statistic::dump(std::ofstream& os) const {
+void V3Statistic::dump(std::ostream& os) const {
     os << "  " << std::right << std::fixed << std::setprecision(precision()) << std::setw(9)
        << value();
 }
@@ -219,7 +220,7 @@ void V3Stats::statsStage(const string& name) {
     V3Stats::addStatPerf("Stage, Memory (MB), " + digitName, memory);
 }
 
-void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
+void V3Stats::infoHeader(std::ostream& os, const string& prefix) {
     os << prefix << "Information:\n";
     os << prefix << "  Version: " << V3Options::version() << '\n';
     os << prefix << "  Arguments: " << v3Global.opt.allArgsString() << '\n';
@@ -233,14 +234,10 @@ void V3Stats::statsReport() {
     // Open stats file
     const string filename
         = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix() + "__stats.txt";
-    std::ofstream* ofp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> ofp{V3File::new_ostream(filename)};
     if (ofp->fail()) v3fatal("Can't write " << filename);
 
-    { StatsReport{ofp}; }  // Destruct before cleanup
-
-    // Cleanup
-    ofp->close();
-    VL_DO_DANGLING(delete ofp, ofp);
+    { StatsReport{ofp.get()}; }
 }
 
 void V3Stats::summaryReport() {
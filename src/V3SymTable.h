@@ -318,7 +318,7 @@ public:
         if (dumpTreeLevel()) {
             const string filename = v3Global.debugFilename(nameComment) + ".txt";
             UINFO(2, "Dumping " << filename << endl);
-            const std::unique_ptr<std::ofstream> logp{V3File::new_ofstream(filename)};
+            const std::unique_ptr<std::ostream> logp{V3File::new_ostream(filename)};
             if (logp->fail()) v3fatal("Can't write " << filename);
             dumpSelf(*logp, "");
         }
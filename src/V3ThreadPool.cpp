@@ -19,6 +19,7 @@
 #include "V3Error.h"
 #include "V3Global.h"
 #include "V3Mutex.h"
+#include "V3PassProfile.h"
 
 V3ThreadPool::V3ThreadPool(int numThreads) {
     numThreads = std::max(numThreads, 1);
@@ -81,7 +82,13 @@ void V3ThreadPool::workerJobLoop() {
             job = std::move(m_queue.front());
             m_queue.pop();
         }
-        job();
+        if (VL_UNLIKELY(V3PassProfile::enabled())) {
+            const uint64_t startUs = V3PassProfile::now();
+            job();
+            V3PassProfile::jobDone(startUs, V3PassProfile::now());
+        } else {
+            job();
+        }
         m_pendingJobs.fetch_sub(1, std::memory_order_release);
     }
 }
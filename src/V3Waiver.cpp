@@ -76,7 +76,7 @@ void V3Waiver::addEntry(V3ErrorCode errorCode, const std::string& filename, cons
 }
 
 void V3Waiver::write(const std::string& filename) VL_MT_SAFE_EXCLUDES(s_mutex) {
-    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+    const std::unique_ptr<std::ostream> ofp{V3File::new_ostream(filename)};
     if (ofp->fail()) v3fatal("Can't write " << filename);
 
     *ofp << "// DESCR"
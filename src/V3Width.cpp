@@ -63,7 +63,7 @@
 // iterateSubtreeReturnEdits.
 //*************************************************************************
 
-#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+#include "V3PchAstMT.h"
 
 #include "V3Width.h"
 
@@ -71,6 +71,7 @@
 #include "V3Begin.h"
 #include "V3Const.h"
 #include "V3Error.h"
+#include "V3FuzzCov.h"
 #include "V3Global.h"
 #include "V3LinkLValue.h"
 #include "V3MemberMap.h"
@@ -78,6 +79,7 @@
 #include "V3Randomize.h"
 #include "V3String.h"
 #include "V3Task.h"
+#include "V3ThreadPool.h"
 #include "V3WidthCommit.h"
 
 // More code; this file was getting too large; see actions there
@@ -161,6 +163,7 @@ public:
     }
     bool prelim() const { return m_stage & PRELIM; }
     bool final() const { return m_stage & FINAL; }
+    Stage stage() const { return m_stage; }
     void dump(std::ostream& str) const {
         if (!m_dtypep) {
             str << "  VUP(s=" << m_stage << ",self)";
@@ -180,19 +183,31 @@ std::ostream& operator<<(std::ostream& str, const WidthVP* vup) {
 
 class WidthClearVisitor final {
     // Rather than a VNVisitor, can just quickly touch every node
-    void clearWidthRecurse(AstNode* nodep) {
-        for (; nodep; nodep = nodep->nextp()) {
-            nodep->didWidth(false);
-            if (nodep->op1p()) clearWidthRecurse(nodep->op1p());
-            if (nodep->op2p()) clearWidthRecurse(nodep->op2p());
-            if (nodep->op3p()) clearWidthRecurse(nodep->op3p());
-            if (nodep->op4p()) clearWidthRecurse(nodep->op4p());
-        }
+    static void clearWidthRecurse(AstNode* nodep) {
+        for (; nodep; nodep = nodep->nextp()) clearWidthSingle(nodep);
+    }
+    static void clearWidthSingle(AstNode* nodep) {
+        nodep->didWidth(false);
+        if (nodep->op1p()) clearWidthRecurse(nodep->op1p());
+        if (nodep->op2p()) clearWidthRecurse(nodep->op2p());
+        if (nodep->op3p()) clearWidthRecurse(nodep->op3p());
+        if (nodep->op4p()) clearWidthRecurse(nodep->op4p());
     }
 
 public:
     // CONSTRUCTORS
-    explicit WidthClearVisitor(AstNetlist* nodep) { clearWidthRecurse(nodep); }
+    explicit WidthClearVisitor(AstNetlist* nodep) {
+        // Modules are disjoint subtrees, so clear them in parallel
+        nodep->didWidth(false);
+        {
+            V3ThreadScope threadScope;
+            for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+                threadScope.enqueue([modp]() { clearWidthSingle(modp); });
+            }
+        }
+        if (nodep->filesp()) clearWidthRecurse(nodep->filesp());
+        if (nodep->miscsp()) clearWidthRecurse(nodep->miscsp());
+    }
     virtual ~WidthClearVisitor() = default;
 };
 
@@ -8001,6 +8016,8 @@ class WidthVisitor final : public VNVisitor {
     }
     void userIterate(AstNode* nodep, WidthVP* vup) {
         if (!nodep) return;
+        V3FuzzCov::hit(V3FuzzCov::WIDTH_VISIT,
+                       (static_cast<uint32_t>(nodep->type()) << 2) | (vup ? vup->stage() : 0));
         VL_RESTORER(m_vup);
         m_vup = vup;
         iterate(nodep);
@@ -8008,6 +8025,8 @@ class WidthVisitor final : public VNVisitor {
     void userIterateAndNext(AstNode* nodep, WidthVP* vup) {
         if (!nodep) return;
         if (nodep->didWidth()) return;  // Avoid iterating list we have already iterated
+        V3FuzzCov::hit(V3FuzzCov::WIDTH_VISIT,
+                       (static_cast<uint32_t>(nodep->type()) << 2) | (vup ? vup->stage() : 0));
         VL_RESTORER(m_vup);
         m_vup = vup;
         iterateAndNextNull(nodep);
@@ -8048,8 +8067,35 @@ void V3Width::width(AstNetlist* nodep) {
         const WidthClearVisitor cvisitor{nodep};
         WidthVisitor visitor{false, false};
         (void)visitor.mainAcceptEdit(nodep);
+        // Width resolution itself is serial as it shares dtypes and tasks across modules,
+        // but removing $signed/$unsigned is local to each module, so do that in parallel.
+        // Each job counts its edits privately, and its visitor is kept here so the removed
+        // nodes are deleted on this thread once all jobs are done.
+        std::vector<AstNode*> modps;
+        for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+            modps.push_back(modp);
+        }
+        std::vector<WidthRemoveVisitor> rvisitors(modps.size());
+        std::vector<uint64_t> editCnts(modps.size(), 0);
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < modps.size(); ++i) {
+                threadScope.enqueue([&, i]() {
+                    AstNode::editCountThread(&editCnts[i]);
+                    (void)rvisitors[i].mainAcceptEdit(modps[i]);
+                    AstNode::editCountThread(nullptr);
+                });
+            }
+        }
+        for (const uint64_t cnt : editCnts) AstNode::editCountMerge(cnt);
+        rvisitors.clear();
         WidthRemoveVisitor rvisitor;
-        (void)rvisitor.mainAcceptEdit(nodep);
+        for (AstNode* itemp = nodep->filesp(); itemp; itemp = itemp->nextp()) {
+            (void)rvisitor.mainAcceptEdit(itemp);
+        }
+        for (AstNode* itemp = nodep->miscsp(); itemp; itemp = itemp->nextp()) {
+            (void)rvisitor.mainAcceptEdit(itemp);
+        }
     }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("width", 0, dumpTreeEitherLevel() >= 3);
 }
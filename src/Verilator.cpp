@@ -54,6 +54,7 @@
 #include "V3Force.h"
 #include "V3Fork.h"
 #include "V3FuncOpt.h"
+#include "V3FuzzCov.h"
 #include "V3Gate.h"
 #include "V3Global.h"
 #include "V3Graph.h"
@@ -77,6 +78,7 @@
 #include "V3Os.h"
 #include "V3Param.h"
 #include "V3ParseSym.h"
+#include "V3PassProfile.h"
 #include "V3PreShell.h"
 #include "V3Premit.h"
 #include "V3ProtectLib.h"
@@ -109,6 +111,7 @@
 #include "V3Width.h"
 #include "V3WidthCommit.h"
 
+#include <csignal>
 #include <ctime>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -143,6 +146,7 @@ static void process() {
         V3LinkLevel::modSortByLevel();
         V3Error::abortIfErrors();
         if (v3Global.opt.debugExitParse()) {
+            if (V3PassProfile::enabled()) V3PassProfile::write();
             cout << "--debug-exit-parse: Exiting after parse\n";
             std::exit(0);
         }
@@ -169,6 +173,7 @@ static void process() {
         if (v3Global.opt.debugExitUvm23()) {
             V3Error::abortIfErrors();
             if (v3Global.opt.serializeOnly()) emitXmlOrJson();
+            if (V3PassProfile::enabled()) V3PassProfile::write();
             cout << "--debug-exit-uvm23: Exiting after UVM-supported pass\n";
             std::exit(0);
         }
@@ -198,6 +203,7 @@ static void process() {
         if (v3Global.opt.debugExitUvm()) {
             V3Error::abortIfErrors();
             if (v3Global.opt.serializeOnly()) emitXmlOrJson();
+            if (V3PassProfile::enabled()) V3PassProfile::write();
             cout << "--debug-exit-uvm: Exiting after UVM-supported pass\n";
             std::exit(0);
         }
@@ -659,6 +665,17 @@ static void verilate(const string& argString) {
     if (!V3Os::getenvStr("VERILATOR_DEBUG_SKIP_IDENTICAL", "").empty()) {  // LCOV_EXCL_START
         v3fatalSrc("VERILATOR_DEBUG_SKIP_IDENTICAL w/ --skip-identical: Changes found\n");
     }  // LCOV_EXCL_STOP
+    // Can we reuse the outputs of an identical hierarchical block Verilation?
+    if (v3Global.opt.hierChild() && !v3Global.opt.hierCache().empty()
+        && V3HierBlockCache::restore()) {
+        // Timestamps must be of the files just written, not those of the cached run
+        if (v3Global.opt.skipIdentical().isTrue() || v3Global.opt.makeDepend().isTrue()) {
+            V3File::writeTimes(v3Global.opt.makeDir() + "/" + v3Global.opt.prefix()
+                                   + "__verFiles.dat",
+                               argString);
+        }
+        return;
+    }
 
     // Disable mutexes in single-thread verilation
     V3MutexConfig::s().configure(v3Global.opt.verilateJobs() > 1 /*enable*/);
@@ -705,6 +722,11 @@ static void verilate(const string& argString) {
 
     // Final steps
     V3Global::dumpCheckGlobalTree("final", 990, dumpTreeEitherLevel() >= 3);
+    if (!v3Global.opt.debugExitAfter().empty()) {
+        v3error("--debug-exit-after: Stage never reached: " << v3Global.opt.debugExitAfter()
+                                                            << " (last stage reached: "
+                                                            << v3Global.lastStage() << ")");
+    }
     if (v3Global.opt.jsonOnly() || dumpTreeJsonLevel()) {
         const string filename
             = (v3Global.opt.jsonOnlyMetaOutput().empty()
@@ -752,13 +774,46 @@ static void verilate(const string& argString) {
                            argString);
     }
 
-    V3Os::filesystemFlushBuildDir(v3Global.opt.makeDir());
-    if (v3Global.opt.hierTop()) V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
+    if (v3Global.opt.hierChild() && !v3Global.opt.hierCache().empty()) {
+        V3HierBlockCache::store();
+    }
+
+    if (v3Global.opt.outputInMemory()) {
+        if (!v3Global.opt.quietStats()) V3File::memoryReport(cout);
+    } else {
+        V3Os::filesystemFlushBuildDir(v3Global.opt.makeDir());
+        if (v3Global.opt.hierTop()) V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
+    }
 
     // Final writing shouldn't throw warnings, but...
     V3Error::abortIfWarnings();
 }
 
+static void fuzzLoop(const string& argString) {
+    // Verilator keeps most state in process-wide singletons (v3Global, V3Error, FileLine
+    // tables, AstNode user pointers).  Rather than resetting all of them between test cases,
+    // each iteration runs in a child forked from this fully initialized process, so startup
+    // and option parsing are paid once, and the parent stays pristine for the next input.
+#ifdef __AFL_HAVE_MANUAL_CONTROL
+    __AFL_INIT();  // Deferred fork server; AFL snapshots after option parsing
+    while (__AFL_LOOP(v3Global.opt.debugFuzzLoop())) {
+#else
+    for (int i = 0; i < v3Global.opt.debugFuzzLoop(); ++i) {
+#endif
+        const int status = V3Os::forkRun([&]() {
+            verilate(argString);
+            return 0;
+        });
+        UINFO(1, "--debug-fuzz-loop: Iteration returned " << status << endl);
+        // Re-raise crashes so the fuzzer attributes them to this test case
+        if (status < 0) std::raise(-status);
+        // Each test case starts from an empty output directory, as a fresh run would
+        V3Os::unlinkRegexp(v3Global.opt.makeDir(), v3Global.opt.prefix() + "*");
+    }
+    // The children did all the work; nothing is left for the parent to build or report
+    std::exit(0);
+}
+
 static string buildMakeCmd(const string& makefile, const string& target) {
     const V3StringList& makeFlags = v3Global.opt.makeFlags();
     const int jobs = v3Global.opt.buildJobs();
@@ -837,14 +892,20 @@ int main(int argc, char** argv) {
     // Validate settings (aka Boost.Program_options)
     v3Global.opt.notify();
     v3Global.rootp()->timeInit();
+    if (v3Global.opt.debugFuzzCov()) V3FuzzCov::boot();
+    if (v3Global.opt.profVerilation()) V3PassProfile::boot();
 
     V3Error::abortIfErrors();
 
-    if (v3Global.opt.verilate()) {
+    if (v3Global.opt.verilate() && v3Global.opt.debugFuzzLoop()) {
+        fuzzLoop(argString);
+    } else if (v3Global.opt.verilate()) {
         verilate(argString);
     } else {
         UINFO(1, "Option --no-verilate: Skip Verilation\n");
     }
+    if (V3FuzzCov::enabled()) V3FuzzCov::report();
+    if (V3PassProfile::enabled()) V3PassProfile::write();
 
     if (v3Global.hierPlanp() && v3Global.opt.gmake()) {
         execHierVerilation();  // execHierVerilation() takes care of --build too
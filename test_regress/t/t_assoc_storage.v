@@ -0,0 +1,113 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+
+module t;
+   // Sparse memory, as used with --assoc-storage
+   bit [63:0] mem[longint unsigned];
+   int        counts[bit [7:0]];
+   int        wide[bit [99:0]];
+   int        named[string];
+   bit [99:0] wide_key;
+   longint unsigned addr;
+   longint unsigned prev_addr;
+   longint unsigned idx[$];
+   bit [7:0]  b;
+   int        n;
+   bit [63:0] sum;
+
+   initial begin
+      // Bursts at scattered bases, written out of order
+      for (int burst = 15; burst >= 0; --burst) begin
+         for (int i = 0; i < 100; ++i) begin
+            addr = (64'(burst) * 64'h1_0000_0001) + 64'(i) * 8;
+            mem[addr] = addr ^ 64'hdead;
+         end
+      end
+      `checkh(mem.num(), 1600);
+      `checkh(mem[64'h1_0000_0001 + 8], (64'h1_0000_0001 + 8) ^ 64'hdead);
+      `checkh(mem.exists(64'h1234), 0);
+      `checkh(mem.exists(64'h2_0000_0002), 1);
+      `checkh(mem.num(), 1600);
+
+      // Ordered iteration after changes
+      mem.delete(64'h0);
+      mem[64'hffff_ffff_ffff_fff8] = 1;
+      n = 0;
+      prev_addr = 0;
+      sum = 0;
+      if (mem.first(addr)) begin
+         do begin
+            if (n != 0 && addr <= prev_addr) $stop;
+            prev_addr = addr;
+            sum += mem[addr];
+            ++n;
+         end while (mem.next(addr));
+      end
+      `checkh(n, 1600);
+      `checkh(prev_addr, 64'hffff_ffff_ffff_fff8);
+      `checkh(mem.first(addr), 1);
+      `checkh(addr, 64'h8);
+      `checkh(mem.last(addr), 1);
+      `checkh(mem.prev(addr), 1);
+      `checkh(addr, 64'hf_0000_000f + 99 * 8);
+
+      // Delete most elements, leaving sparse pages
+      for (int burst = 0; burst < 16; ++burst) begin
+         for (int i = 0; i < 100; ++i) begin
+            addr = (64'(burst) * 64'h1_0000_0001) + 64'(i) * 8;
+            if (i != 50) mem.delete(addr);
+         end
+      end
+      `checkh(mem.num(), 17);
+      idx = mem.find_index(x) with (x[15:12] == 4'hd);
+      `checkh(idx.size(), 16);
+      `checkh(idx[0], 64'h0 + 50 * 8);
+      `checkh(idx[15], 64'hf_0000_000f + 50 * 8);
+      idx = mem.find_last_index(x) with (x != 1);
+      `checkh(idx[0], 64'hf_0000_000f + 50 * 8);
+      mem.delete();
+      `checkh(mem.num(), 0);
+      `checkh(mem.first(addr), 0);
+
+      // Drain in order from both ends, which must not re-sort each time
+      for (int i = 0; i < 20000; ++i) mem[64'(i) * 8] = 64'(i);
+      n = 0;
+      while (mem.first(addr)) begin
+         `checkh(addr, 64'(n) * 8);
+         mem.delete(addr);
+         ++n;
+         if (mem.last(addr)) begin
+            `checkh(addr, 64'(19999 - n + 1) * 8);
+            mem.delete(addr);
+         end
+      end
+      `checkh(n, 10000);
+
+      // Small integral key
+      for (int i = 0; i < 256; i += 3) counts[8'(i * 7)] = i;
+      `checkh(counts.num(), 86);
+      `checkh(counts.first(b), 1);
+      `checkh(b, 8'h0);
+      `checkh(counts.next(b), 1);
+      `checkh(b, 8'h1);
+      `checks($sformatf("%p", counts.min()), "'{'h0} ");
+
+      // Keys not stored with alternative storage
+      wide[100'h1_0000_0000_0000_0000_0000] = 2;
+      wide[100'h1] = 1;
+      `checkh(wide.first(wide_key), 1);
+      `checkh(wide_key, 100'h1);
+      named["b"] = 2;
+      named["a"] = 1;
+      `checks($sformatf("%p", named), "'{\"a\":'h1, \"b\":'h2} ");
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
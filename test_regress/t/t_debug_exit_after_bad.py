@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t_EXAMPLE.v"
+
+test.lint(verilator_flags2=["--debug-exit-after nosuchstage"], fails=True)
+
+test.file_grep(test.compile_log_filename,
+               r'--debug-exit-after: Stage never reached: nosuchstage \(last stage reached: final\)')
+
+test.passes()
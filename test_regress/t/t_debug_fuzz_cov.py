@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t_EXAMPLE.v"
+
+test.lint(verilator_flags2=["--debug-fuzz-cov --debugi-V3FuzzCov 1"])
+
+test.file_grep(test.compile_log_filename, r'--debug-fuzz-cov: No fuzzer map, using private map')
+test.file_grep(test.compile_log_filename, r'--debug-fuzz-cov: Private map has [1-9]\d* edges hit')
+# 'cyc + 1' in t_EXAMPLE.v is width resolved, so that V3Width rule must be recorded
+test.file_grep(test.compile_log_filename, r'--debug-fuzz-cov: Rule WIDTH_VISIT ADD/[PFB] hits [1-9]')
+
+test.passes()
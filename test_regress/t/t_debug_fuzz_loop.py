@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t_EXAMPLE.v"
+
+test.lint(verilator_flags2=["--debug-fuzz-loop 3 --debugi-Verilator 1"])
+
+test.file_grep_count(test.compile_log_filename, r'--debug-fuzz-loop: Iteration returned 0', 3)
+
+test.passes()
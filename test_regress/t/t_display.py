@@ -15,4 +15,14 @@ test.compile()
 
 test.execute(expect_filename=test.golden_filename)
 
+if test.vlt_all:
+    # Formats are pre-parsed into items, not parsed at runtime
+    files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+    test.file_grep_any(files, r'VL_WRITEF_L\(')
+    # Control characters and NULs are quoted, with the length given explicitly
+    test.file_grep_any(files,
+                       r'VL_FMT_LIT\("<\\001\\033\\177\\"\\\\BA\\000\\000\|C(\\000){7}\|", 20\)')
+    for filename in files:
+        test.file_grep_not(filename, r'VL_WRITEF_NX\(')
+
 test.passes()
@@ -17,6 +17,7 @@ module t;
    int        n; initial n = 23;
    reg [7:0]  m; initial m = 24;
    string     svs = "sv-str";
+   string     str_fmt;
    reg [31:0] regstr = "meep";
 
    reg [5:0]  assoc_c[int];
@@ -192,6 +193,19 @@ multiline", $time);
       $write("'%-8s'\n", regstr);
       $write("'%8s'\n", "beep");
       $write("'%-8s'\n", "beep");
+      // Left justify applies only to its own conversion
+      $write("'%-5d|%5d|%-6s|%6s'\n", n, n, regstr, regstr);
+
+`ifdef VERILATOR
+      // Literal text with control characters, and NULs from constant %u/%z,
+      // keeps its length in the generated C++ (see t_display.py)
+      str_fmt = $sformatf("<\001\033\177\"\\%u|%z|%0t>", 16'h4142, 8'h43, $time);
+      if (str_fmt.len() != 22) $stop;
+      if (str_fmt[1] != 8'o001 || str_fmt[3] != 8'o177 || str_fmt[5] != "\\") $stop;
+      if (str_fmt[6] != "B" || str_fmt[7] != "A" || str_fmt[9] != 8'h0) $stop;
+      if (str_fmt[11] != "C" || str_fmt[18] != 8'h0 || str_fmt[19] != "|") $stop;
+      if (str_fmt[20] != "0" || str_fmt[21] != ">") $stop;
+`endif
 
       // $itord conversion bug, note a %d instead of proper float
       // verilator lint_off REALCVT
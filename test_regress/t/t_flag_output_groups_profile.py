@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import re
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_csplit.v"
+
+profile = test.obj_dir + "/compile_times.log"
+
+flags = [
+    "--output-split 1", "--output-groups 2", "--output-split-cfuncs 1", "--stats",
+    "--output-groups-profile " + profile
+]
+
+
+def build():
+    test.run(logfile=test.obj_dir + "/vlt_gcc.log",
+             tee=test.verbose,
+             cmd=[
+                 os.environ["MAKE"], "-C " + test.obj_dir, "-f " + test.vm_prefix + ".mk",
+                 "-j 4", "VM_PREFIX=" + test.vm_prefix, "TEST_OBJ_DIR=" + test.obj_dir,
+                 "CPPFLAGS_DRIVER=-D" + test.name.upper(), "VM_COMPILE_TIMES=compile_times.log"
+             ])
+
+
+# First run has no profile yet, so groups by estimated complexity
+test.compile(v_flags2=flags + ["--exe ../" + test.main_filename], verilator_make_gmake=False)
+build()
+test.file_grep(profile, r'^\d+\.\d+ \S*_vm_classes_\d+\.cpp')
+# Read directly, as test.stats is rewritten by the second run
+with open(test.stats, 'r', encoding="utf8") as fh:
+    if re.search(r'Concatenation profiled files', fh.read()):
+        test.error("First run used a profile")
+
+# Second run balances by the recorded compile times
+test.compile(v_flags2=flags + ["--exe ../" + test.main_filename], verilator_make_gmake=False)
+test.file_grep(test.stats, r'Concatenation profiled files + (\d+)')
+build()
+
+test.execute()
+
+test.passes()
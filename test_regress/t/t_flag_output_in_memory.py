@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import hashlib
+import os
+import re
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_EXAMPLE.v"
+
+test.compile(verilator_flags2=['--output-in-memory', '--stats'],
+             verilator_make_gmake=False,
+             make_top_shell=False,
+             make_main=False)
+
+test.file_grep(test.compile_log_filename, r'- Output: [0-9a-f]{64} +\d+ .*/' + test.vm_prefix + r'\.h')
+test.file_grep(test.compile_log_filename, r'- Output: [0-9a-f]{64} +\d+ .*/' + test.vm_prefix + r'\.mk')
+test.file_grep(test.compile_log_filename, r'- Output: \d+ files, \d+ bytes kept in memory')
+
+test.file_grep(test.compile_log_filename,
+               r'- Output: [0-9a-f]{64} +\d+ .*/' + test.vm_prefix + r'__stats\.txt')
+
+for suffix in [".h", "__stats.txt", "__ver.d"]:
+    if os.path.exists(test.obj_dir + "/" + test.vm_prefix + suffix):
+        test.error("--output-in-memory wrote " + test.vm_prefix + suffix + " to disk")
+
+# The in-memory dependency file must list the same targets as a run writing to disk
+with open(test.compile_log_filename, "r", encoding="latin-1") as fh:
+    memory_log = fh.read()
+test.compile(verilator_flags2=['--stats'],
+             verilator_make_gmake=False,
+             make_top_shell=False,
+             make_main=False)
+depend_filename = test.obj_dir + "/" + test.vm_prefix + "__ver.d"
+with open(depend_filename, 'rb') as fh:
+    depend_sha = hashlib.sha256(fh.read()).hexdigest()
+if not re.search(r'- Output: ' + depend_sha + r' +\d+ .*/' + test.vm_prefix + r'__ver\.d',
+                 memory_log):
+    test.error("--output-in-memory " + test.vm_prefix + "__ver.d differs from a disk run")
+
+test.passes()
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_flag_csplit.v"
+
+test.compile(verilator_flags2=["--output-stable-names", "--output-split 1"])
+
+found = False
+for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root__DepSet_*.cpp"):
+    # Split files are named by the hash of their first function, not numbered
+    if not re.search(r'__DepSet_[0-9a-f]{8}__[0-9a-f]{8}__0(__Slow)?\.cpp$', filename):
+        test.error("Split file not named by content: " + filename)
+    with open(filename, 'r', encoding="utf8") as fh:
+        if re.search(r'_(comb|sequent)__TOP__h[0-9a-f]{8}\(', fh.read()):
+            found = True
+if not found:
+    test.error("No function named by content found")
+
+test.execute()
+
+test.passes()
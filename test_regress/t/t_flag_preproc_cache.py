@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_initial.v"
+
+flags = ['--preproc-cache', test.obj_dir + '/cache', '--debugi-V3PreShell 2']
+
+test.compile(verilator_flags2=flags)
+test.file_grep(test.compile_log_filename, r'--preproc-cache: Wrote')
+
+# Second run must reuse the entry, including the `include it depends on
+test.compile(verilator_flags2=flags)
+test.file_grep(test.compile_log_filename, r'--preproc-cache: Reusing')
+
+test.execute()
+
+test.passes()
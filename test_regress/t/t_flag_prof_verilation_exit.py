@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import json
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_EXAMPLE.v"
+
+test.lint(verilator_flags2=["--prof-verilation --debug-exit-after width"])
+
+filename = test.obj_dir + "/" + test.vm_prefix + "__prof_verilation.json"
+with open(filename, 'r', encoding="utf8") as fh:
+    trace = json.load(fh)
+
+names = [event['name'] for event in trace['traceEvents'] if event['ph'] == 'X']
+# Written even though --debug-exit-after exits early
+if 'width' not in names:
+    test.error("Pass 'width' missing from " + filename)
+if 'final' in names:
+    test.error("Pass 'final' after --debug-exit-after width in " + filename)
+
+test.passes()
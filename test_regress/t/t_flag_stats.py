@@ -15,4 +15,6 @@ test.compile(verilator_flags2=["--stats --stats-vars"])
 
 test.execute()
 
+test.file_grep(test.stats, r'Allocator, Pooled objects allocated\s+(\d+)')
+
 test.passes()
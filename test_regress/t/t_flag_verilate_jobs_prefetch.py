@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import glob
+import re
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_func_lib.v"
+
+flags = ['-v', 't/t_func_lib_sub.v', '--debugi-V3File 2', '--debugi-V3Global 2']
+
+
+def outputs():
+    result = {}
+    for filename in glob.glob(test.obj_dir + "/" + test.vm_prefix + "*.[ch]*"):
+        with open(filename, 'r', encoding="latin-1") as fh:
+            result[os.path.basename(filename)] = fh.read()
+    return result
+
+
+test.compile(verilator_flags2=flags + ["--verilate-jobs 4"])
+
+# Both the top and library file are read ahead, then used by the preprocessor
+with open(test.compile_log_filename, 'r', encoding="utf8") as fh:
+    log = fh.read()
+if not re.search(r'Prefetching 2 source files', log):
+    test.error("Top and library files were not prefetched")
+used = re.findall(r'Using prefetched (\S+)', log)
+if sorted(os.path.basename(f) for f in used) != ["t_func_lib.v", "t_func_lib_sub.v"]:
+    test.error("Prefetched files not used: " + str(used))
+jobs_outputs = outputs()
+
+test.compile(verilator_flags2=flags + ["--verilate-jobs 1"])
+
+with open(test.compile_log_filename, 'r', encoding="utf8") as fh:
+    if re.search(r'Prefetching|Using prefetched', fh.read()):
+        test.error("Prefetched with --verilate-jobs 1")
+serial_outputs = outputs()
+if not serial_outputs:
+    test.error("No outputs found")
+if jobs_outputs != serial_outputs:
+    differ = sorted(f for f in set(jobs_outputs) | set(serial_outputs)
+                    if jobs_outputs.get(f) != serial_outputs.get(f))
+    test.error("Output differs between --verilate-jobs 4 and 1: " + str(differ))
+
+test.execute()
+
+test.passes()
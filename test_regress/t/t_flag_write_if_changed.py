@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_skipidentical.v"
+
+flags = ['--write-if-changed', '--no-skip-identical']
+
+test.compile(verilator_flags2=flags)
+
+outfile = test.obj_dir + "/V" + test.name + ".cpp"
+oldstats = os.path.getmtime(outfile)
+print("Old mtime=", oldstats)
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+# Verilates again, but produces identical output
+test.compile(verilator_flags2=flags)
+
+newstats = os.path.getmtime(outfile)
+print("New mtime=", newstats)
+
+if oldstats != newstats:
+    test.error("--write-if-changed rewrote an unchanged file")
+
+test.execute()
+
+test.passes()
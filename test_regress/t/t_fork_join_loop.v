@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`timescale 1ns/1ns
+
+module t;
+   // Many processes each repeatedly forking and joining, so that coroutine
+   // frames and join state are reused immediately after being released
+   localparam int PROCS = 20;
+   localparam int ITERS = 50;
+   int count;
+   int done_procs;
+
+   for (genvar p = 0; p < PROCS; ++p) begin : g_proc
+      initial begin
+         for (int i = 0; i < ITERS; ++i) begin
+            fork
+               #1 count++;
+               #2 count++;
+               begin
+                  #(p % 3) count++;
+               end
+            join
+         end
+         done_procs++;
+      end
+   end
+
+   initial begin
+      wait (done_procs == PROCS);
+      if (count != PROCS * ITERS * 3) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
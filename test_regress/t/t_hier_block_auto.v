@@ -0,0 +1,42 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] in = 0;
+   wire [31:0] out0, out1, out2;
+
+   // No hier_block metacomments; blocks are selected by --hierarchical=auto
+   sub u0 (.clk, .in(in), .out(out0));
+   sub u1 (.clk, .in(in + 1), .out(out1));
+   sub u2 (.clk, .in(out0), .out(out2));
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      in <= in + 32'h11;
+      if (cyc > 2) begin
+         if (out0 != (in - 32'h11) * 3 + 1) $stop;
+         if (out1 != (in - 32'h10) * 3 + 1) $stop;
+      end
+      if (cyc == 10) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub (
+   input clk,
+   input [31:0] in,
+   output logic [31:0] out
+   );
+   always @(posedge clk) out <= in * 3 + 1;
+endmodule
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import re
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_hier_block.v"
+
+test.clean_objs()
+
+cache_dir = test.obj_dir + "/hier_cache"
+flags = [
+    '--hierarchical', '--Wno-TIMESCALEMOD', '--CFLAGS', '"-pipe -DCPP_MACRO=cplusplus"',
+    '--hierarchical-cache', cache_dir, '--debugi-V3HierBlock 1'
+]
+
+
+def read_log():
+    # Block runs are logged by make
+    with open(test.obj_dir + "/vlt_gcc.log", 'r', encoding="utf8") as fh:
+        return fh.read()
+
+
+test.compile(v_flags2=['t/t_hier_block.cpp'], verilator_flags2=flags)
+
+if not re.search(r'--hierarchical-cache: Wrote \S*/Vsub0__\S+\.vhc', read_log()):
+    test.error("Hierarchical block sub0 was not cached")
+
+sub1_mtime = os.stat(test.obj_dir + "/Vsub1/sub1.sv").st_mtime_ns
+
+# Remove a block's output so it must be Verilated again, which is then served from the cache
+os.unlink(test.obj_dir + "/Vsub0/sub0.sv")
+
+test.compile(v_flags2=['t/t_hier_block.cpp'], verilator_flags2=flags)
+
+log = read_log()
+reused = re.findall(r'--hierarchical-cache: Reusing (\S+)', log)
+if len(reused) != 1 or not re.search(r'/Vsub0__\S+\.vhc$', reused[0]):
+    test.error("Expected only sub0 to be reused from the cache, got " + str(reused))
+if re.search(r'--hierarchical-cache: (Wrote|Stale)', log):
+    test.error("Unchanged hierarchical block was Verilated again")
+
+test.file_grep(test.obj_dir + "/Vsub0/sub0.sv", r'^module\s+(\S+)\s+', "sub0")
+if os.stat(test.obj_dir + "/Vsub1/sub1.sv").st_mtime_ns != sub1_mtime:
+    test.error("Outputs of an up to date hierarchical block were regenerated")
+
+# Timestamps must be of the restored file, not those of the run that was cached
+sub0_sv = test.obj_dir + "/Vsub0/sub0.sv"
+stat = os.stat(sub0_sv)
+times = test.file_contents(test.obj_dir + "/Vsub0/Vsub0__verFiles.dat")
+m = re.search(r'^T\s+\d+\s+\d+\s+\d+\s+\d+\s+(\d+)\s+(\d+)\s+"[^"]*/sub0\.sv"', times, re.M)
+if not m:
+    test.error("sub0.sv missing from Vsub0__verFiles.dat")
+elif int(m.group(1)) * 1000000000 + int(m.group(2)) != stat.st_mtime_ns:
+    test.error("Vsub0__verFiles.dat has timestamps of the cached run")
+
+test.execute()
+
+test.passes()
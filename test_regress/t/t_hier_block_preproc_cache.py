@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import os
+import re
+import shutil
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_hier_block.v"
+
+test.clean_objs()
+
+cache_dir = test.obj_dir + "/preproc_cache"
+
+flags = [
+    '--hierarchical', '--Wno-TIMESCALEMOD', '--CFLAGS', '"-pipe -DCPP_MACRO=cplusplus"',
+    '--preproc-cache', cache_dir, '--debugi-V3PreShell 2'
+]
+
+test.compile(v_flags2=['t/t_hier_block.cpp'], verilator_flags2=flags)
+
+# Remove all outputs but the cache, so every hierarchical block is Verilated again
+for filename in os.listdir(test.obj_dir):
+    path = test.obj_dir + "/" + filename
+    if path == cache_dir:
+        continue
+    if os.path.isdir(path):
+        shutil.rmtree(path)
+    else:
+        os.unlink(path)
+
+test.compile(v_flags2=['t/t_hier_block.cpp'], verilator_flags2=flags)
+
+test.execute()
+
+# The block runs are logged by make. Each of the 14 block runs must reuse the
+# entry for the source, none may preprocess it again.
+with open(test.obj_dir + "/vlt_gcc.log", 'r', encoding="utf8") as fh:
+    log = fh.read()
+reused = re.findall(r'--preproc-cache: Reusing \S*/t_hier_block__', log)
+if len(reused) < 14:
+    test.error("Expected each hierarchical block run to reuse preprocessed source, got "
+               + str(len(reused)) + " reuses")
+if re.search(r'--preproc-cache: (Wrote|Stale)', log):
+    test.error("Hierarchical block run preprocessed a cached source again")
+
+test.passes()
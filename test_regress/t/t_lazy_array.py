@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--lazy-array-size 65536"])
+
+test.execute()
+
+# Nonzero reset values are still written when the model is constructed
+test.execute(all_run_flags=["+verilator+rand+reset+1 +ones"])
+
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.h")
+test.file_grep_any(files, r'lazyAlloc')
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+test.file_grep_any(files, r'randReset\(\)\)\) \{')
+
+test.passes()
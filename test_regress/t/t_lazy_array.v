@@ -0,0 +1,46 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+
+module t;
+   // Large enough to be zero-filled on demand with --lazy-array-size
+   logic [31:0] mem[0:(1 << 22) - 1];
+   logic [71:0] wide[0:1023][0:255];
+   // Small enough to be reset as usual
+   logic [31:0] small[0:15];
+
+   logic        ones;
+   logic [31:0] exp32;
+   logic [71:0] exp72;
+
+   initial begin
+      ones = $test$plusargs("ones");
+      exp32 = ones ? '1 : '0;
+      exp72 = ones ? '1 : '0;
+
+      `checkh(mem[0], exp32);
+      `checkh(mem[(1 << 21) + 7], exp32);
+      `checkh(mem[(1 << 22) - 1], exp32);
+      `checkh(wide[0][0], exp72);
+      `checkh(wide[1023][255], exp72);
+      `checkh(small[3], exp32);
+
+      for (int i = 0; i < (1 << 22); i += 4093) mem[i] = i;
+      wide[512][17] = 72'hab_cdef0123_456789ab;
+      small[3] = 32'h1234;
+
+      for (int i = 0; i < (1 << 22); i += 4093) `checkh(mem[i], i);
+      `checkh(mem[1], exp32);
+      `checkh(mem[(1 << 22) - 2], exp32);
+      `checkh(wide[512][17], 72'hab_cdef0123_456789ab);
+      `checkh(wide[512][18], exp72);
+      `checkh(small[3], 32'h1234);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
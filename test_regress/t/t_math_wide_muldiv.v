@@ -0,0 +1,90 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0)
+
+// Check wide multiply, divide and modulus through arithmetic identities,
+// over the range of widths where the runtime changes algorithm
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+   integer cyc = 0;
+
+   sub #(.W(100)) i_100 (.*);
+   sub #(.W(256)) i_256 (.*);
+   sub #(.W(1000)) i_1000 (.*);
+   sub #(.W(2048)) i_2048 (.*);
+   sub #(.W(4096)) i_4096 (.*);
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 60) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub #(parameter W = 64)
+   (/*AUTOARG*/
+   // Inputs
+   clk, cyc
+   );
+
+   input clk;
+   input integer cyc;
+
+   logic [W-1:0] a;
+   logic [W-1:0] b;
+   logic [W-1:0] c;
+   int           sh;
+
+   always @(posedge clk) begin
+      logic [W-1:0] q;
+      logic [W-1:0] r;
+      logic signed [W-1:0] qs;
+      logic signed [W-1:0] rs;
+      if (cyc > 0) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] W=%0d a=%0d b=%0d\n", $time, W, $clog2(a), $clog2(b));
+`endif
+         `checkh(a * b, b * a);
+         `checkh(a * (b + c), a * b + a * c);
+         `checkh(a * (W'(1) << sh), a << sh);
+         if (b != '0) begin
+            q = a / b;
+            r = a % b;
+            `checkh(r < b, 1'b1);
+            `checkh(q * b + r, a);
+            qs = $signed(a) / $signed(b);
+            rs = $signed(a) % $signed(b);
+            `checkh(qs * $signed(b) + rs, $signed(a));
+            `checkh(rs == '0 || rs[W-1] == a[W-1], 1'b1);
+         end
+         `checkh(a / '0, '0);
+      end
+      // New random stimulus, with operands of random sizes and some edge cases
+      for (int i = 0; i < W; ++i) a[i] = 1'($urandom);
+      for (int i = 0; i < W; ++i) b[i] = 1'($urandom);
+      for (int i = 0; i < W; ++i) c[i] = 1'($urandom);
+      a = a >> ($urandom % W);
+      b = b >> ($urandom % W);
+      case (cyc % 8)
+        1: a = '1;
+        2: b = '1;
+        3: b = {1'b1, {(W - 1){1'b0}}};
+        4: b = a;
+        5: b = W'(1);
+        default: ;
+      endcase
+      sh = int'($urandom % W);
+   end
+endmodule
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile()
+
+test.execute()
+
+if test.vlt_all:
+    # Small widths use the width-specialized templates
+    files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+    test.file_grep_any(files, r'VL_ADD_W<3>\(')
+    test.file_grep_any(files, r'VL_ADD_W\(10, ')
+
+test.passes()
@@ -0,0 +1,109 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0)
+
+// Check the wide operators, whose runtime may use vectorized kernels,
+// against bit-by-bit reference computations
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+   integer cyc = 0;
+
+   sub #(.W(96)) i_96 (.*);
+   sub #(.W(300)) i_300 (.*);
+   sub #(.W(1024)) i_1024 (.*);
+   sub #(.W(2047)) i_2047 (.*);
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 50) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub #(parameter W = 64)
+   (/*AUTOARG*/
+   // Inputs
+   clk, cyc
+   );
+
+   input clk;
+   input integer cyc;
+
+   logic [W-1:0] a;
+   logic [W-1:0] b;
+   int           s;
+
+   function automatic logic [W-1:0] ref_add(logic [W-1:0] x, logic [W-1:0] y, logic cin);
+      logic c = cin;
+      for (int i = 0; i < W; ++i) begin
+         ref_add[i] = x[i] ^ y[i] ^ c;
+         c = (x[i] & y[i]) | (c & (x[i] ^ y[i]));
+      end
+   endfunction
+
+   function automatic logic [W-1:0] ref_shiftr(logic [W-1:0] x, int sh);
+      for (int i = 0; i < W; ++i) ref_shiftr[i] = (i + sh < W) ? x[i + sh] : 1'b0;
+   endfunction
+
+   function automatic logic [W-1:0] ref_shiftrs(logic [W-1:0] x, int sh);
+      for (int i = 0; i < W; ++i) ref_shiftrs[i] = (i + sh < W) ? x[i + sh] : x[W - 1];
+   endfunction
+
+   always @(posedge clk) begin
+      logic [W-1:0] band;
+      logic [W-1:0] bor;
+      logic [W-1:0] bxor;
+      logic [W-1:0] bnot;
+      logic         beq;
+      logic         rxor;
+      int           ones;
+      if (cyc > 0) begin
+         for (int i = 0; i < W; ++i) begin
+            band[i] = a[i] & b[i];
+            bor[i] = a[i] | b[i];
+            bxor[i] = a[i] ^ b[i];
+            bnot[i] = ~a[i];
+         end
+         beq = (bxor == '0);
+         rxor = 1'b0;
+         ones = 0;
+         for (int i = 0; i < W; ++i) begin
+            rxor ^= a[i];
+            ones += int'(a[i]);
+         end
+`ifdef TEST_VERBOSE
+         $write("[%0t] W=%0d s=%0d eq=%b ones=%0d\n", $time, W, s, beq, ones);
+`endif
+         `checkh(a & b, band);
+         `checkh(a | b, bor);
+         `checkh(a ^ b, bxor);
+         `checkh(~a, bnot);
+         `checkh(a == b, beq);
+         `checkh(a != b, !beq);
+         `checkh(^a, rxor);
+         `checkh($countones(a), ones);
+         `checkh(a + b, ref_add(a, b, 1'b0));
+         `checkh(a - b, ref_add(a, ~b, 1'b1));
+         `checkh(a >> s, ref_shiftr(a, s));
+         `checkh($signed(a) >>> s, ref_shiftrs(a, s));
+      end
+      // New random stimulus, with runs of equal or all-ones values
+      for (int i = 0; i < W; ++i) a[i] = 1'($urandom);
+      if (cyc % 5 == 1) a = '1;
+      for (int i = 0; i < W; ++i) b[i] = 1'($urandom);
+      if (cyc % 3 == 0) b = a;
+      s = int'($urandom % (W + 40));
+   end
+endmodule
@@ -9,6 +9,7 @@ module t (/*AUTOARG*/);
    localparam TWO = 2;
 
    int q[$ : TWO];  // Shall not go higher than [2], i.e. size 3
+   int u[$];
 
    initial begin
       q.push_front(3);
@@ -36,6 +37,13 @@ module t (/*AUTOARG*/);
       if (q[1] != 1) $stop;
       if (q[2] != 2) $stop;
 
+      // Assignment from a longer queue keeps the elements that fit
+      u = '{10, 11, 12, 13, 14};
+      q = u;
+      if (q.size() != 3) $stop;
+      if (q[0] != 10) $stop;
+      if (q[2] != 12) $stop;
+
       $write("*-* All Finished *-*\n");
       $finish;
    end
@@ -0,0 +1,73 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t(/*AUTOARG*/);
+
+   int q[$];
+   string qs[$];
+   int qb[$:999];
+
+   // References to elements are held across the delay, while the other
+   // process grows the queues well past their initial storage
+   task automatic set_int(ref int vrefed, input int value);
+`ifdef TEST_NOINLINE
+      // verilator no_inline_task
+`endif
+      `checkd(vrefed, 1);
+      #100;
+      vrefed = value;
+   endtask
+
+   task automatic set_string(ref string vrefed);
+`ifdef TEST_NOINLINE
+      // verilator no_inline_task
+`endif
+      `checks(vrefed, "first");
+      #100;
+      vrefed = "changed";
+   endtask
+
+   initial begin
+      q.push_back(1);
+      qs.push_back("first");
+      qb.push_back(1);
+      fork
+         set_int(q[0], 10);
+         set_string(qs[0]);
+         set_int(qb[0], 20);
+      join
+      `checkd(q.size(), 3001);
+      `checkd(q[1000], 10);
+      `checkd(q[999], 999);
+      `checkd(q[1001], 1000);
+      `checkd(qs.size(), 3001);
+      `checks(qs[1000], "changed");
+      `checkd(qb.size(), 1000);
+      `checkd(qb[0], 20);
+      `checkd(qb[999], 999);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+   initial begin
+      #50;
+      for (int i = 0; i < 1000; ++i) begin
+         q.push_front(999 - i);
+         qs.push_front($sformatf("%0d", 999 - i));
+      end
+      for (int i = 0; i < 2000; ++i) begin
+         q.push_back(1000 + i);
+         qs.push_back($sformatf("%0d", 1000 + i));
+      end
+      for (int i = 1; i < 1000; ++i) qb.push_back(i);
+   end
+
+endmodule
@@ -0,0 +1,91 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+
+module t;
+   // Queues wrapping around and growing
+   int q[$];
+   int b[$:7];
+   string s[$];
+   int r[$];
+   int exp;
+   int sum;
+
+   initial begin
+      // Wrap the unbounded queue repeatedly as a FIFO, then grow it
+      for (int i = 0; i < 100; ++i) begin
+         q.push_back(i);
+         if (q.size() > 5) `checkh(q.pop_front(), i - 5);
+      end
+      `checkh(q.size(), 5);
+      for (int i = 0; i < 100; ++i) q.push_front(-i);
+      `checkh(q.size(), 105);
+      `checkh(q[0], -99);
+      `checkh(q[99], 0);
+      `checkh(q[104], 99);
+
+      // Insert and delete from both halves of a wrapped queue
+      q.insert(1, 1000);
+      q.insert(100, 2000);
+      `checkh(q[1], 1000);
+      `checkh(q[100], 2000);
+      `checkh(q[101], 0);
+      q.delete(100);
+      q.delete(1);
+      `checkh(q[1], -98);
+      `checkh(q[100], 95);
+      `checkh(q.size(), 105);
+
+      // Methods over a wrapped queue
+      q.sort();
+      for (int i = 1; i < q.size(); ++i) if (q[i - 1] > q[i]) $stop;
+      q.rsort();
+      `checkh(q[0], 99);
+      q.reverse();
+      `checkh(q[0], -99);
+      r = q.find(x) with (x > 96);
+      `checkh(r.size(), 3);
+      sum = q.sum() with (item > 0 ? item : 0);
+      `checkh(sum, 99 * 100 / 2 - (94 * 95 / 2));
+
+      // Bounded queue stays within its bound while wrapping
+      for (int i = 0; i < 50; ++i) begin
+         b.push_back(i);
+         if (i % 3 == 0) void'(b.pop_front());
+      end
+      `checkh(b.size(), 8);
+      `checkh(b[7], 49);
+      b.push_front(-1);
+      `checkh(b.size(), 8);
+      `checkh(b[0], -1);
+      `checkh(b[7], 46);
+      b[8] = 123;
+      `checkh(b.size(), 8);
+      `checkh(b[7], 46);
+      b.insert(2, 77);
+      `checkh(b.size(), 8);
+      `checkh(b[2], 77);
+      `checkh(b[7], 43);
+      b.insert(8, 5);
+      `checkh(b.size(), 8);
+      `checkh(b[7], 43);
+
+      // Non-trivial elements
+      for (int i = 0; i < 40; ++i) begin
+         s.push_back($sformatf("element_number_%0d", i));
+         if (i % 2 == 0) s.push_front(s[s.size() - 1]);
+      end
+      `checkh(s.size(), 60);
+      if (s[0] != "element_number_38") $stop;
+      if (s[59] != "element_number_39") $stop;
+      s.sort();
+      if (s[0] != "element_number_0") $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
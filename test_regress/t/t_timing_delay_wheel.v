@@ -0,0 +1,57 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`timescale 1ns/1ns
+
+module t;
+   // Delays on either side of the timing wheel's level boundaries
+   localparam int N = 10;
+   longint delays[N] = '{1, 2, 255, 256, 257, 65535, 65536, 65537,
+                         64'h1_0000_0001, 64'h100_0000_0000};
+   int done = 0;
+   int order[$];
+
+   task automatic waiter(int id, longint dly);
+      longint start = $time;
+      for (int i = 0; i < 3; i++) #(dly);
+      if ($time != start + dly * 3) begin
+         $display("%%Error: waiter %0d woke at %0t, expected %0t", id, $time, start + dly * 3);
+         $stop;
+      end
+      done++;
+   endtask
+
+   initial begin
+      for (int i = 0; i < N; i++) begin
+         fork
+            automatic int id = i;
+            waiter(id, delays[id]);
+         join_none
+      end
+   end
+
+   // Processes resuming at the same time resume in the order they were delayed
+   initial begin
+      #300;
+      fork
+         begin #70000; order.push_back(1); end
+         begin #70000; order.push_back(2); end
+         begin #70000; order.push_back(3); end
+      join
+      if (order != '{1, 2, 3}) begin
+         $display("%%Error: order %p", order);
+         $stop;
+      end
+      done++;
+   end
+
+   initial begin
+      wait (done == N + 1);
+      if ($time != 64'h300_0000_0000) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule